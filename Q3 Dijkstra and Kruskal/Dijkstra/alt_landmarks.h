@@ -0,0 +1,384 @@
+#ifndef ALT_LANDMARKS_H
+#define ALT_LANDMARKS_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <queue>
+#include <limits>
+#include <thread>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include "csr_graph.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Define LandmarkTable struct: distances from every landmark to every star, landmark-major
+// Routes are two-way so the distance from a landmark equals the distance to it and one table serves both bounds
+// The distances either live in owned storage or point into a memory-mapped file
+struct LandmarkTable {
+    int landmark_count = 0;
+    int star_count = 0;
+    std::vector<int> landmarks;
+    const double *distances = nullptr;
+    std::vector<double> storage;
+    void *mapping = nullptr;
+    size_t mapping_size = 0;
+
+    double distance(int landmark, int star) const { return distances[static_cast<size_t>(landmark) * star_count + star]; }
+};
+
+// Function to release a landmark table, unmapping the file if it was memory-mapped
+void release_landmark_table(LandmarkTable &table) {
+#ifndef _WIN32
+    if (table.mapping != nullptr) {
+        munmap(table.mapping, table.mapping_size);
+    }
+#endif
+    table.mapping = nullptr;
+    table.mapping_size = 0;
+    table.distances = nullptr;
+    table.storage.clear();
+}
+
+// Function to select landmarks by farthest-point sampling
+// Each new landmark is the star farthest (by route) from all landmarks chosen so far
+std::vector<int> select_landmarks_farthest(const CsrGraph &csr, int count, int first) {
+    std::vector<int> landmarks;
+    std::vector<double> nearest(csr.star_count(), std::numeric_limits<double>::infinity());
+    int next = first;
+
+    while (static_cast<int>(landmarks.size()) < count && next >= 0) {
+        landmarks.push_back(next);
+        std::vector<double> from_landmark = csr_dijkstra(csr, next);
+        next = -1;
+        double farthest = -1;
+        for (int star = 0; star < csr.star_count(); ++star) {
+            nearest[star] = std::min(nearest[star], from_landmark[star]);
+            // Unreachable stars are skipped so each component does not swallow every landmark
+            if (nearest[star] != std::numeric_limits<double>::infinity() && nearest[star] > farthest) {
+                farthest = nearest[star];
+                next = star;
+            }
+        }
+        if (farthest <= 0) {
+            break;
+        }
+    }
+
+    return landmarks;
+}
+
+// Function to select landmarks with the avoid heuristic (Goldberg and Werneck)
+// A shortest path tree is grown from a random root and each star is weighted by how badly the current
+// landmarks bound its distance; the next landmark is the leaf reached by following the heaviest subtrees
+std::vector<int> select_landmarks_avoid(const CsrGraph &csr, int count, unsigned int seed) {
+    int n = csr.star_count();
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    std::vector<int> landmarks;
+    std::vector<std::vector<double>> tables;
+
+    while (static_cast<int>(landmarks.size()) < count) {
+        int root = pick(rng);
+
+        // Shortest path tree from the root, with settle order for a bottom-up pass
+        std::vector<double> distances(n, std::numeric_limits<double>::infinity());
+        std::vector<int> parent(n, -1), settle_order;
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+        distances[root] = 0;
+        pq.push({0, root});
+        while (!pq.empty()) {
+            double current_distance = pq.top().first;
+            int current = pq.top().second;
+            pq.pop();
+            if (current_distance > distances[current]) {
+                continue;
+            }
+            settle_order.push_back(current);
+            for (int e = csr.offsets[current]; e < csr.offsets[current + 1]; ++e) {
+                double new_distance = current_distance + csr.distances[e];
+                if (new_distance < distances[csr.targets[e]]) {
+                    distances[csr.targets[e]] = new_distance;
+                    parent[csr.targets[e]] = current;
+                    pq.push({new_distance, csr.targets[e]});
+                }
+            }
+        }
+
+        // Weight = exact distance minus the best landmark lower bound
+        // Subtrees that already contain a landmark get size zero
+        std::vector<double> size(n, 0);
+        std::vector<bool> has_landmark(n, false);
+        for (int landmark : landmarks) {
+            has_landmark[landmark] = true;
+        }
+        for (auto it = settle_order.rbegin(); it != settle_order.rend(); ++it) {
+            int star = *it;
+            double bound = 0;
+            for (const auto &table : tables) {
+                bound = std::max(bound, std::abs(table[star] - table[root]));
+            }
+            size[star] += distances[star] - bound;
+            if (has_landmark[star]) {
+                size[star] = 0;
+            }
+            if (parent[star] >= 0) {
+                if (has_landmark[star]) {
+                    has_landmark[parent[star]] = true;
+                }
+                size[parent[star]] += size[star];
+            }
+        }
+
+        // Follow the heaviest child from the root down to a leaf
+        std::vector<int> heaviest(n, -1);
+        for (int star : settle_order) {
+            int up = parent[star];
+            if (up >= 0 && (heaviest[up] < 0 || size[star] > size[heaviest[up]])) {
+                heaviest[up] = star;
+            }
+        }
+        int leaf = root;
+        while (heaviest[leaf] >= 0 && size[heaviest[leaf]] > 0) {
+            leaf = heaviest[leaf];
+        }
+        if (std::find(landmarks.begin(), landmarks.end(), leaf) != landmarks.end()) {
+            break; // Every subtree is covered
+        }
+
+        landmarks.push_back(leaf);
+        tables.push_back(csr_dijkstra(csr, leaf));
+    }
+
+    return landmarks;
+}
+
+// Function to compute the landmark distance table, running one Dijkstra per landmark across threads
+LandmarkTable build_landmark_table(const CsrGraph &csr, const std::vector<int> &landmarks, int thread_count) {
+    LandmarkTable table;
+    table.landmarks = landmarks;
+    table.landmark_count = static_cast<int>(landmarks.size());
+    table.star_count = csr.star_count();
+    table.storage.resize(static_cast<size_t>(table.landmark_count) * table.star_count);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < std::max(1, thread_count); ++t) {
+        workers.emplace_back([&table, &csr, &landmarks, t, thread_count]() {
+            for (int l = t; l < static_cast<int>(landmarks.size()); l += std::max(1, thread_count)) {
+                std::vector<double> from_landmark = csr_dijkstra(csr, landmarks[l]);
+                std::copy(from_landmark.begin(), from_landmark.end(), table.storage.begin() + static_cast<size_t>(l) * table.star_count);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    table.distances = table.storage.data();
+    return table;
+}
+
+const uint32_t ALT_TABLE_MAGIC = 0x544C4141; // "AALT"
+
+// Define LandmarkFileHeader struct: fixed-size header so the distance block starts 8-byte aligned
+struct LandmarkFileHeader {
+    uint32_t magic;
+    int32_t landmark_count;
+    int32_t star_count;
+    int32_t reserved;
+};
+
+// Function to save a landmark table: header, landmark ids padded to 8 bytes, then the distance block
+void save_landmark_table(const LandmarkTable &table, const std::string &filename) {
+    std::ofstream outfile(filename, std::ios::binary);
+    if (!outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return;
+    }
+
+    LandmarkFileHeader header = {ALT_TABLE_MAGIC, table.landmark_count, table.star_count, 0};
+    std::vector<int32_t> ids(table.landmarks.begin(), table.landmarks.end());
+    if (ids.size() % 2 == 1) {
+        ids.push_back(-1);
+    }
+    outfile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    outfile.write(reinterpret_cast<const char *>(ids.data()), sizeof(int32_t) * ids.size());
+    outfile.write(reinterpret_cast<const char *>(table.distances), sizeof(double) * table.landmark_count * table.star_count);
+
+    outfile.close();
+}
+
+// Function to load a landmark table, memory-mapping the file so the distances are paged in on demand
+// Falls back to reading the file into memory where mmap is not available
+// The table is checked to be well formed, not to belong to a graph: callers compare star_count with their graph
+bool load_landmark_table(LandmarkTable &table, const std::string &filename) {
+    LandmarkFileHeader header;
+    const char *bytes = nullptr;
+    std::vector<char> buffer;
+
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    struct stat info;
+    fstat(fd, &info);
+    size_t size = static_cast<size_t>(info.st_size);
+    void *mapping = size >= sizeof(header) ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Error mapping file: " << filename << std::endl;
+        return false;
+    }
+    table.mapping = mapping;
+    table.mapping_size = size;
+    bytes = static_cast<const char *>(mapping);
+#else
+    std::ifstream infile(filename, std::ios::binary);
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    buffer.assign(std::istreambuf_iterator<char>(infile), std::istreambuf_iterator<char>());
+    size_t size = buffer.size();
+    bytes = buffer.data();
+#endif
+
+    // Check the header before trusting it: counts not negative, the ids and distances inside the file (the
+    // counts are 32-bit, so their product fits in 64 bits), and every landmark id naming one of the stars
+    bool valid = size >= sizeof(header);
+    if (valid) {
+        std::memcpy(&header, bytes, sizeof(header));
+        valid = header.magic == ALT_TABLE_MAGIC && header.landmark_count >= 0 && header.star_count >= 0;
+    }
+    size_t id_slots = valid ? header.landmark_count + header.landmark_count % 2 : 0;
+    size_t distance_offset = sizeof(header) + sizeof(int32_t) * id_slots;
+    if (valid) {
+        uint64_t cells = static_cast<uint64_t>(header.landmark_count) * static_cast<uint64_t>(header.star_count);
+        valid = size >= distance_offset && cells <= (size - distance_offset) / sizeof(double);
+    }
+    for (int32_t l = 0; valid && l < header.landmark_count; ++l) {
+        int32_t id;
+        std::memcpy(&id, bytes + sizeof(header) + sizeof(int32_t) * l, sizeof(id));
+        valid = id >= 0 && id < header.star_count;
+    }
+    if (!valid) {
+        std::cerr << "Not a landmark table: " << filename << std::endl;
+        release_landmark_table(table);
+        return false;
+    }
+
+    table.landmark_count = header.landmark_count;
+    table.star_count = header.star_count;
+    const int32_t *ids = reinterpret_cast<const int32_t *>(bytes + sizeof(header));
+    table.landmarks.assign(ids, ids + header.landmark_count);
+    if (buffer.empty()) {
+        table.distances = reinterpret_cast<const double *>(bytes + distance_offset);
+    } else {
+        const double *first = reinterpret_cast<const double *>(bytes + distance_offset);
+        table.storage.assign(first, first + static_cast<size_t>(header.landmark_count) * header.star_count);
+        table.distances = table.storage.data();
+    }
+    return true;
+}
+
+// Define AltQuery struct: reusable A* state, reset sparsely after each query
+struct AltQuery {
+    std::vector<double> distance;
+    std::vector<int> parent;
+    std::vector<int> touched;
+    int settled = 0; // stars settled by the last query
+
+    explicit AltQuery(int star_count) : distance(star_count, std::numeric_limits<double>::infinity()), parent(star_count, -1) {}
+};
+
+// Function to compute the landmark lower bound on the distance between two stars (triangle inequality)
+double alt_lower_bound(const LandmarkTable &table, int star, int target) {
+    double bound = 0;
+    for (int l = 0; l < table.landmark_count; ++l) {
+        double to_star = table.distance(l, star);
+        double to_target = table.distance(l, target);
+        if (to_star == std::numeric_limits<double>::infinity() || to_target == std::numeric_limits<double>::infinity()) {
+            if (to_star != to_target) {
+                return std::numeric_limits<double>::infinity(); // The landmark proves the stars are disconnected
+            }
+            continue;
+        }
+        bound = std::max(bound, std::abs(to_target - to_star));
+    }
+    return bound;
+}
+
+// Function to answer a point-to-point query with A* guided by landmark lower bounds
+// The bounds are consistent, so every star is settled at most once and the answer equals dijkstra()
+double alt_shortest_path(const CsrGraph &csr, const LandmarkTable &table, AltQuery &query, int source, int target, std::vector<int> *path = nullptr) {
+    typedef std::pair<double, int> Entry; // (distance + lower bound, star)
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> pq;
+    query.settled = 0;
+    query.distance[source] = 0;
+    query.touched.push_back(source);
+    pq.push({alt_lower_bound(table, source, target), source});
+
+    double result = std::numeric_limits<double>::infinity();
+    while (!pq.empty()) {
+        double key = pq.top().first;
+        int current = pq.top().second;
+        pq.pop();
+
+        double current_distance = query.distance[current];
+        if (key > current_distance + alt_lower_bound(table, current, target) + 1e-9) {
+            continue; // Stale entry
+        }
+        ++query.settled;
+        if (current == target) {
+            result = current_distance;
+            break;
+        }
+
+        for (int e = csr.offsets[current]; e < csr.offsets[current + 1]; ++e) {
+            int next = csr.targets[e];
+            double new_distance = current_distance + csr.distances[e];
+            if (new_distance < query.distance[next]) {
+                double bound = alt_lower_bound(table, next, target);
+                if (bound == std::numeric_limits<double>::infinity()) {
+                    continue;
+                }
+                if (query.distance[next] == std::numeric_limits<double>::infinity()) {
+                    query.touched.push_back(next);
+                }
+                query.distance[next] = new_distance;
+                query.parent[next] = current;
+                pq.push({new_distance + bound, next});
+            }
+        }
+    }
+
+    if (path != nullptr) {
+        path->clear();
+        if (result != std::numeric_limits<double>::infinity()) {
+            for (int star = target; star >= 0; star = query.parent[star]) {
+                path->push_back(star);
+            }
+            std::reverse(path->begin(), path->end());
+        }
+    }
+
+    for (int star : query.touched) {
+        query.distance[star] = std::numeric_limits<double>::infinity();
+        query.parent[star] = -1;
+    }
+    query.touched.clear();
+
+    return result;
+}
+
+#endif // ALT_LANDMARKS_H
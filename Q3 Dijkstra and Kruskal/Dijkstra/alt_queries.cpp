@@ -0,0 +1,82 @@
+// Build: g++ -O2 -std=c++17 -pthread -I../../common alt_queries.cpp -o alt_queries.exe
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdlib>
+#include "dijkstra_operations.h"
+#include "csr_graph.h"
+#include "alt_landmarks.h"
+
+// Function to select landmarks, build and save the table, reload it with mmap and time random queries
+void run_alt(const CsrGraph &csr, int landmark_count, const std::string &heuristic, int query_count) {
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+    auto start_build = std::chrono::steady_clock::now();
+    std::vector<int> landmarks = heuristic == "avoid" ? select_landmarks_avoid(csr, landmark_count, 11)
+                                                      : select_landmarks_farthest(csr, landmark_count, 0);
+    LandmarkTable built = build_landmark_table(csr, landmarks, thread_count);
+    auto end_build = std::chrono::steady_clock::now();
+    save_landmark_table(built, "alt_landmarks.bin");
+
+    LandmarkTable table;
+    if (!load_landmark_table(table, "alt_landmarks.bin")) {
+        return;
+    }
+    if (table.star_count != csr.star_count()) {
+        std::cerr << "Landmark table is for " << table.star_count << " stars, the graph has " << csr.star_count() << std::endl;
+        release_landmark_table(table);
+        return;
+    }
+
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> pick(0, csr.star_count() - 1);
+    AltQuery query(csr.star_count());
+    long long settled = 0;
+    int mismatches = 0;
+    double total_seconds = 0;
+    for (int q = 0; q < query_count; ++q) {
+        int source = pick(rng), target = pick(rng);
+        auto start_query = std::chrono::steady_clock::now();
+        double distance = alt_shortest_path(csr, table, query, source, target);
+        auto end_query = std::chrono::steady_clock::now();
+        total_seconds += std::chrono::duration<double>(end_query - start_query).count();
+        settled += query.settled;
+
+        if (q < 20) {
+            double expected = csr_dijkstra(csr, source)[target];
+            if (std::abs(distance - expected) > 1e-6 * std::max(1.0, expected)) {
+                ++mismatches;
+            }
+        }
+    }
+
+    std::cout << "Stars: " << csr.star_count() << ", routes: " << csr.edge_count() / 2 << std::endl;
+    std::cout << "Landmarks (" << heuristic << "): " << table.landmark_count << ", preprocessing on " << thread_count << " threads: "
+              << std::chrono::duration<double>(end_build - start_build).count() << " seconds" << std::endl;
+    std::cout << "Average query latency: " << total_seconds / query_count * 1e6 << " microseconds, average stars settled: "
+              << static_cast<double>(settled) / query_count << " of " << csr.star_count() << std::endl;
+    std::cout << "Mismatches against Dijkstra: " << mismatches << std::endl;
+
+    release_landmark_table(table);
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: alt_queries [farthest|avoid] [landmark_count] [star_count route_count]
+    std::string heuristic = argc >= 2 ? argv[1] : "farthest";
+    int landmark_count = argc >= 3 ? std::atoi(argv[2]) : 4;
+
+    if (argc >= 5) {
+        CsrGraph csr = generate_random_csr_graph(std::atoi(argv[3]), std::atoi(argv[4]), 7);
+        run_alt(csr, landmark_count, heuristic, 1000);
+        return 0;
+    }
+
+    std::vector<DijkstraStar> stars;
+    std::vector<std::vector<Edge>> graph;
+    StarIdTable ids;
+    read_star_dataset("dataset2_1.txt", stars, graph, ids);
+    run_alt(build_csr_graph(graph, ids), landmark_count, heuristic, 10000);
+
+    return 0;
+}
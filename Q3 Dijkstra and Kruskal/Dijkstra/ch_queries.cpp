@@ -0,0 +1,110 @@
+// Build: g++ -O2 -std=c++17 -I../../common ch_queries.cpp -o ch_queries.exe
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "dijkstra_operations.h"
+#include "csr_graph.h"
+#include "contraction_hierarchies.h"
+
+// Function to measure the size of a file in bytes
+long long file_size(const std::string &filename) {
+    std::ifstream infile(filename, std::ios::binary | std::ios::ate);
+    return infile.is_open() ? static_cast<long long>(infile.tellg()) : -1;
+}
+
+// Function to build, save, reload and query a hierarchy, printing build time, index size and query latency
+void run_contraction_hierarchy(const CsrGraph &csr, const std::string &index_filename, int query_count) {
+    auto start_build = std::chrono::steady_clock::now();
+    ContractionHierarchy built = build_contraction_hierarchy(csr);
+    auto end_build = std::chrono::steady_clock::now();
+    save_contraction_hierarchy(built, index_filename);
+
+    ContractionHierarchy ch;
+    if (!load_contraction_hierarchy(ch, index_filename)) {
+        return;
+    }
+
+    // Time random point-to-point queries, checking the first few hundred against plain Dijkstra
+    const int checked_queries = 300;
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> pick(0, csr.star_count() - 1);
+    ChQuery query(ch.star_count());
+    int mismatches = 0;
+    double total_seconds = 0;
+    for (int q = 0; q < query_count; ++q) {
+        int source = pick(rng), target = pick(rng);
+        auto start_query = std::chrono::steady_clock::now();
+        double distance = ch_shortest_path(ch, query, source, target);
+        auto end_query = std::chrono::steady_clock::now();
+        total_seconds += std::chrono::duration<double>(end_query - start_query).count();
+
+        if (q < checked_queries) {
+            double expected = csr_dijkstra(csr, source)[target];
+            if (std::abs(distance - expected) > 1e-6 * std::max(1.0, expected)) {
+                ++mismatches;
+            }
+        }
+    }
+
+    std::cout << "Stars: " << csr.star_count() << ", routes: " << csr.edge_count() / 2 << std::endl;
+    std::cout << "Build time: " << std::chrono::duration<double>(end_build - start_build).count() << " seconds, shortcuts added: " << ch.shortcut_count << std::endl;
+    std::cout << "Index size: " << file_size(index_filename) << " bytes (" << index_filename << ")" << std::endl;
+    std::cout << "Average query latency: " << total_seconds / query_count * 1e6 << " microseconds over " << query_count << " queries" << std::endl;
+    std::cout << "Mismatches against Dijkstra: " << mismatches << " of " << std::min(query_count, checked_queries) << " queries checked" << std::endl;
+}
+
+// Function to save the hierarchy's answers from Star A in the same format as shortest_paths.txt
+// Star names are looked up in ids, a hash lookup each, rather than scanned for in the graph
+void save_ch_paths(const ContractionHierarchy &ch, const std::vector<DijkstraStar> &stars, const StarIdTable &ids, const std::string &filename) {
+    std::ofstream outfile(filename);
+    if (!outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return;
+    }
+
+    ChQuery query(ch.star_count());
+    int source = ids.find("A");
+    for (const auto &star : stars) {
+        int target = ids.find(star.name);
+        std::vector<int> path;
+        double distance = source < 0 || target < 0 ? std::numeric_limits<double>::infinity() : ch_shortest_path(ch, query, source, target, &path);
+        if (distance == std::numeric_limits<double>::infinity()) {
+            outfile << "Star " << star.name << " is unreachable from Star A." << std::endl;
+            continue;
+        }
+        outfile << "Shortest distance from Star A to Star " << star.name << " is " << distance << ", path: {";
+        for (size_t i = 0; i < path.size(); ++i) {
+            outfile << ch.names[path[i]] << (i + 1 < path.size() ? ", " : "");
+        }
+        outfile << "}" << std::endl;
+    }
+
+    outfile.close();
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: ch_queries [star_count route_count] -- without arguments the star dataset is used
+    if (argc >= 3) {
+        CsrGraph csr = generate_random_csr_graph(std::atoi(argv[1]), std::atoi(argv[2]), 7);
+        run_contraction_hierarchy(csr, "ch_index_random.bin", 100000);
+        return 0;
+    }
+
+    std::vector<DijkstraStar> stars;
+    std::vector<std::vector<Edge>> graph;
+    StarIdTable ids;
+    read_star_dataset("dataset2_1.txt", stars, graph, ids);
+    CsrGraph csr = build_csr_graph(graph, ids);
+
+    run_contraction_hierarchy(csr, "ch_index.bin", 100000);
+
+    ContractionHierarchy ch;
+    if (load_contraction_hierarchy(ch, "ch_index.bin")) {
+        save_ch_paths(ch, stars, ids, "ch_shortest_paths.txt");
+        std::cout << "Result is saved to ch_shortest_paths.txt" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,423 @@
+#ifndef CONTRACTION_HIERARCHIES_H
+#define CONTRACTION_HIERARCHIES_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include "csr_graph.h"
+#include "dijkstra_workspace.h"
+
+// Define ChArc struct: an edge of the hierarchy, middle is the contracted star a shortcut bypasses (-1 for an original route)
+struct ChArc {
+    int to;
+    double distance;
+    int middle;
+};
+
+// Define ContractionHierarchy struct
+// Only upward arcs (towards higher ranked stars) are kept, stored in CSR form
+struct ContractionHierarchy {
+    std::vector<std::string> names;
+    std::vector<int> rank;          // contraction order of each star
+    std::vector<int> up_offsets;
+    std::vector<int> up_targets;
+    std::vector<double> up_distances;
+    std::vector<int> up_middles;
+    int shortcut_count = 0;
+
+    int star_count() const { return static_cast<int>(rank.size()); }
+};
+
+// Function to search for a witness path from source that avoids the star being contracted
+// The search is bounded by max_distance and settle_limit so contraction stays local. It runs once for
+// every pair of neighbours of every contracted star, so it works in a DijkstraWorkspace sized for the whole
+// graph and only resets the stars it touched.
+double ch_witness_distance(const std::vector<std::vector<ChArc>> &arcs, const std::vector<bool> &contracted, DijkstraWorkspace &workspace, int source, int target, int skip, double max_distance, int settle_limit) {
+    auto later = std::greater<std::pair<double, int>>();
+    workspace.distance[source] = 0;
+    workspace.touched.push_back(source);
+    workspace.heap.push_back({0, source});
+    int settled = 0;
+
+    while (!workspace.heap.empty()) {
+        std::pop_heap(workspace.heap.begin(), workspace.heap.end(), later);
+        double current_distance = workspace.heap.back().first;
+        int current = workspace.heap.back().second;
+        workspace.heap.pop_back();
+
+        if (current_distance > workspace.distance[current]) {
+            continue;
+        }
+        if (current == target || current_distance > max_distance || ++settled > settle_limit) {
+            break;
+        }
+
+        for (const auto &arc : arcs[current]) {
+            if (arc.to == skip || contracted[arc.to]) {
+                continue;
+            }
+            double new_distance = current_distance + arc.distance;
+            if (new_distance < workspace.distance[arc.to]) {
+                if (workspace.distance[arc.to] == std::numeric_limits<double>::infinity()) {
+                    workspace.touched.push_back(arc.to);
+                }
+                workspace.distance[arc.to] = new_distance;
+                workspace.heap.push_back({new_distance, arc.to});
+                std::push_heap(workspace.heap.begin(), workspace.heap.end(), later);
+            }
+        }
+    }
+
+    double witness = workspace.distance[target];
+    workspace.reset();
+    return witness;
+}
+
+// Function to find the shortcuts needed to contract one star without modifying the graph
+// The ordering also calls this to estimate the edge difference of a star
+std::vector<std::pair<std::pair<int, int>, double>> ch_contract_star(const std::vector<std::vector<ChArc>> &arcs, const std::vector<bool> &contracted, DijkstraWorkspace &workspace, int star, int settle_limit) {
+    std::vector<std::pair<std::pair<int, int>, double>> shortcuts;
+
+    // Collect the shortest arc to every remaining neighbour: sorted by neighbour then distance, the first
+    // arc of each neighbour is its shortest
+    std::vector<std::pair<int, double>> list;
+    for (const auto &arc : arcs[star]) {
+        if (!contracted[arc.to]) {
+            list.push_back({arc.to, arc.distance});
+        }
+    }
+    std::sort(list.begin(), list.end());
+    list.erase(std::unique(list.begin(), list.end(), [](const std::pair<int, double> &a, const std::pair<int, double> &b) { return a.first == b.first; }), list.end());
+
+    for (size_t i = 0; i < list.size(); ++i) {
+        for (size_t j = i + 1; j < list.size(); ++j) {
+            double via = list[i].second + list[j].second;
+            double witness = ch_witness_distance(arcs, contracted, workspace, list[i].first, list[j].first, star, via, settle_limit);
+            if (witness > via) {
+                shortcuts.push_back({{list[i].first, list[j].first}, via});
+            }
+        }
+    }
+
+    return shortcuts;
+}
+
+// Function to add or shorten an undirected arc between two stars
+void ch_add_arc(std::vector<std::vector<ChArc>> &arcs, int from, int to, double distance, int middle) {
+    for (auto &arc : arcs[from]) {
+        if (arc.to == to) {
+            if (distance < arc.distance) {
+                arc.distance = distance;
+                arc.middle = middle;
+            }
+            return;
+        }
+    }
+    arcs[from].push_back({to, distance, middle});
+}
+
+// Function to build a contraction hierarchy from a CsrGraph
+// Stars are ordered by edge difference plus contracted neighbours, using lazy priority updates
+ContractionHierarchy build_contraction_hierarchy(const CsrGraph &csr, int settle_limit = 64) {
+    int n = csr.star_count();
+    std::vector<std::vector<ChArc>> arcs(n);
+    for (int u = 0; u < n; ++u) {
+        for (int e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+            if (csr.targets[e] != u) {
+                ch_add_arc(arcs, u, csr.targets[e], csr.distances[e], -1);
+            }
+        }
+    }
+
+    std::vector<bool> contracted(n, false);
+    std::vector<int> contracted_neighbours(n, 0);
+    DijkstraWorkspace workspace(n);
+
+    auto priority = [&](int star) {
+        int degree = 0;
+        for (const auto &arc : arcs[star]) {
+            if (!contracted[arc.to]) {
+                ++degree;
+            }
+        }
+        int added = static_cast<int>(ch_contract_star(arcs, contracted, workspace, star, settle_limit).size());
+        return added - degree + contracted_neighbours[star];
+    };
+
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> order;
+    for (int star = 0; star < n; ++star) {
+        order.push({priority(star), star});
+    }
+
+    ContractionHierarchy ch;
+    ch.names = csr.names;
+    ch.rank.assign(n, 0);
+    int next_rank = 0;
+
+    while (!order.empty()) {
+        int star = order.top().second;
+        order.pop();
+
+        // Lazy update: recompute the priority and put the star back if it is no longer the minimum
+        int current = priority(star);
+        if (!order.empty() && current > order.top().first) {
+            order.push({current, star});
+            continue;
+        }
+
+        for (const auto &shortcut : ch_contract_star(arcs, contracted, workspace, star, settle_limit)) {
+            int a = shortcut.first.first, b = shortcut.first.second;
+            ch_add_arc(arcs, a, b, shortcut.second, star);
+            ch_add_arc(arcs, b, a, shortcut.second, star);
+            ++ch.shortcut_count;
+        }
+
+        contracted[star] = true;
+        ch.rank[star] = next_rank++;
+        for (const auto &arc : arcs[star]) {
+            ++contracted_neighbours[arc.to];
+        }
+    }
+
+    // Keep only arcs that lead upwards in the order
+    ch.up_offsets.assign(n + 1, 0);
+    for (int u = 0; u < n; ++u) {
+        for (const auto &arc : arcs[u]) {
+            if (ch.rank[arc.to] > ch.rank[u]) {
+                ch.up_targets.push_back(arc.to);
+                ch.up_distances.push_back(arc.distance);
+                ch.up_middles.push_back(arc.middle);
+            }
+        }
+        ch.up_offsets[u + 1] = static_cast<int>(ch.up_targets.size());
+    }
+
+    return ch;
+}
+
+// Function to write a vector as raw bytes
+template <typename T>
+void ch_write_vector(std::ofstream &outfile, const std::vector<T> &values) {
+    uint64_t size = values.size();
+    outfile.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    outfile.write(reinterpret_cast<const char *>(values.data()), sizeof(T) * values.size());
+}
+
+// Function to read a vector written by ch_write_vector
+template <typename T>
+bool ch_read_vector(std::ifstream &infile, std::vector<T> &values) {
+    uint64_t size = 0;
+    if (!infile.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+        return false;
+    }
+    values.resize(size);
+    return static_cast<bool>(infile.read(reinterpret_cast<char *>(values.data()), sizeof(T) * size));
+}
+
+// Function to write star names as one newline-separated block (names never contain whitespace)
+void ch_write_names(std::ofstream &outfile, const std::vector<std::string> &names) {
+    std::vector<char> bytes;
+    for (const auto &name : names) {
+        bytes.insert(bytes.end(), name.begin(), name.end());
+        bytes.push_back('\n');
+    }
+    ch_write_vector(outfile, bytes);
+}
+
+// Function to read star names written by ch_write_names
+bool ch_read_names(std::ifstream &infile, std::vector<std::string> &names) {
+    std::vector<char> bytes;
+    if (!ch_read_vector(infile, bytes)) {
+        return false;
+    }
+    names.clear();
+    auto begin = bytes.begin();
+    for (auto it = bytes.begin(); it != bytes.end(); ++it) {
+        if (*it == '\n') {
+            names.emplace_back(begin, it);
+            begin = it + 1;
+        }
+    }
+    return true;
+}
+
+const uint32_t CH_INDEX_MAGIC = 0x32494843; // "CHI2", string star names (was "CHIX" with one char per star)
+
+// Function to save a contraction hierarchy to a binary index file
+void save_contraction_hierarchy(const ContractionHierarchy &ch, const std::string &filename) {
+    std::ofstream outfile(filename, std::ios::binary);
+    if (!outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return;
+    }
+
+    int32_t shortcut_count = ch.shortcut_count;
+    outfile.write(reinterpret_cast<const char *>(&CH_INDEX_MAGIC), sizeof(CH_INDEX_MAGIC));
+    outfile.write(reinterpret_cast<const char *>(&shortcut_count), sizeof(shortcut_count));
+    ch_write_names(outfile, ch.names);
+    ch_write_vector(outfile, ch.rank);
+    ch_write_vector(outfile, ch.up_offsets);
+    ch_write_vector(outfile, ch.up_targets);
+    ch_write_vector(outfile, ch.up_distances);
+    ch_write_vector(outfile, ch.up_middles);
+
+    outfile.close();
+}
+
+// Function to load a contraction hierarchy saved by save_contraction_hierarchy
+bool load_contraction_hierarchy(ContractionHierarchy &ch, const std::string &filename) {
+    std::ifstream infile(filename, std::ios::binary);
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+
+    uint32_t magic = 0;
+    int32_t shortcut_count = 0;
+    infile.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    infile.read(reinterpret_cast<char *>(&shortcut_count), sizeof(shortcut_count));
+    if (magic != CH_INDEX_MAGIC) {
+        std::cerr << "Not a contraction hierarchy index: " << filename << std::endl;
+        return false;
+    }
+    ch.shortcut_count = shortcut_count;
+
+    return ch_read_names(infile, ch.names) && ch_read_vector(infile, ch.rank) &&
+           ch_read_vector(infile, ch.up_offsets) && ch_read_vector(infile, ch.up_targets) &&
+           ch_read_vector(infile, ch.up_distances) && ch_read_vector(infile, ch.up_middles);
+}
+
+// Define ChQuery struct: reusable search state so a query only resets the stars it touched
+struct ChQuery {
+    std::vector<double> distance[2];
+    std::vector<int> parent[2];     // arc slot used to reach each star, -1 for the search root
+    std::vector<int> touched[2];
+
+    explicit ChQuery(int star_count) {
+        for (int side = 0; side < 2; ++side) {
+            distance[side].assign(star_count, std::numeric_limits<double>::infinity());
+            parent[side].assign(star_count, -1);
+        }
+    }
+};
+
+// Function to find the arc slot from a star up to another star, -1 if absent
+int ch_find_up_arc(const ContractionHierarchy &ch, int from, int to) {
+    for (int e = ch.up_offsets[from]; e < ch.up_offsets[from + 1]; ++e) {
+        if (ch.up_targets[e] == to) {
+            return e;
+        }
+    }
+    return -1;
+}
+
+// Function to expand an arc into the original stars it passes, appending everything after from
+void ch_unpack_arc(const ContractionHierarchy &ch, int from, int to, int middle, std::vector<int> &path) {
+    if (middle < 0) {
+        path.push_back(to);
+        return;
+    }
+    // The bypassed star is ranked below both ends, so both halves are upward arcs out of it
+    int first = ch_find_up_arc(ch, middle, from);
+    int second = ch_find_up_arc(ch, middle, to);
+    ch_unpack_arc(ch, from, middle, ch.up_middles[first], path);
+    ch_unpack_arc(ch, middle, to, ch.up_middles[second], path);
+}
+
+// Function to answer a point-to-point query with a bidirectional upward search
+// Returns the distance and fills path with star indices when a path is requested
+double ch_shortest_path(const ContractionHierarchy &ch, ChQuery &query, int source, int target, std::vector<int> *path = nullptr) {
+    typedef std::pair<double, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> pq[2];
+    int roots[2] = {source, target};
+    for (int side = 0; side < 2; ++side) {
+        query.distance[side][roots[side]] = 0;
+        query.touched[side].push_back(roots[side]);
+        pq[side].push({0, roots[side]});
+    }
+
+    double best = std::numeric_limits<double>::infinity();
+    int meeting = -1;
+    while (!pq[0].empty() || !pq[1].empty()) {
+        for (int side = 0; side < 2; ++side) {
+            if (pq[side].empty()) {
+                continue;
+            }
+            double current_distance = pq[side].top().first;
+            int current = pq[side].top().second;
+            pq[side].pop();
+
+            // A direction is finished once its smallest key cannot improve the best meeting point
+            if (current_distance >= best) {
+                pq[side] = std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>>();
+                continue;
+            }
+            if (current_distance > query.distance[side][current]) {
+                continue;
+            }
+
+            double other = query.distance[1 - side][current];
+            if (current_distance + other < best) {
+                best = current_distance + other;
+                meeting = current;
+            }
+
+            for (int e = ch.up_offsets[current]; e < ch.up_offsets[current + 1]; ++e) {
+                int next = ch.up_targets[e];
+                double new_distance = current_distance + ch.up_distances[e];
+                if (new_distance < query.distance[side][next]) {
+                    if (query.distance[side][next] == std::numeric_limits<double>::infinity()) {
+                        query.touched[side].push_back(next);
+                    }
+                    query.distance[side][next] = new_distance;
+                    query.parent[side][next] = e;
+                    pq[side].push({new_distance, next});
+                }
+            }
+        }
+    }
+
+    if (path != nullptr) {
+        path->clear();
+        if (meeting >= 0) {
+            // Walk both search trees back from the meeting star, then unpack every shortcut
+            std::vector<std::pair<int, int>> up_chain; // (lower star, arc slot) from source side
+            for (int star = meeting; query.parent[0][star] >= 0;) {
+                int e = query.parent[0][star];
+                int lower = static_cast<int>(std::upper_bound(ch.up_offsets.begin(), ch.up_offsets.end(), e) - ch.up_offsets.begin()) - 1;
+                up_chain.push_back({lower, e});
+                star = lower;
+            }
+            std::reverse(up_chain.begin(), up_chain.end());
+            path->push_back(source);
+            for (const auto &step : up_chain) {
+                ch_unpack_arc(ch, step.first, ch.up_targets[step.second], ch.up_middles[step.second], *path);
+            }
+            for (int star = meeting; query.parent[1][star] >= 0;) {
+                int e = query.parent[1][star];
+                int lower = static_cast<int>(std::upper_bound(ch.up_offsets.begin(), ch.up_offsets.end(), e) - ch.up_offsets.begin()) - 1;
+                ch_unpack_arc(ch, star, lower, ch.up_middles[e], *path);
+                star = lower;
+            }
+        }
+    }
+
+    // Sparse reset so the next query does not pay for the whole graph
+    for (int side = 0; side < 2; ++side) {
+        for (int star : query.touched[side]) {
+            query.distance[side][star] = std::numeric_limits<double>::infinity();
+            query.parent[side][star] = -1;
+        }
+        query.touched[side].clear();
+    }
+
+    return best;
+}
+
+#endif // CONTRACTION_HIERARCHIES_H
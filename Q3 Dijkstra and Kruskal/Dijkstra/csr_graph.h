@@ -0,0 +1,178 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include "dijkstra_operations.h"
+
+// Define CsrGraph struct: adjacency lists packed into flat arrays (compressed sparse row)
+// Star i owns the edge slots [offsets[i], offsets[i + 1])
+struct CsrGraph {
+    std::vector<std::string> names; // star id -> star name
+    std::vector<int> offsets;       // size = star count + 1
+    std::vector<int> targets;       // destination star id per edge slot
+    std::vector<double> distances;  // edge length per edge slot
+
+    int star_count() const { return static_cast<int>(offsets.size()) - 1; }
+    int edge_count() const { return static_cast<int>(targets.size()); }
+};
+
+// Function to convert the adjacency lists used by dijkstra() into a CsrGraph; star ids are kept as they are
+CsrGraph build_csr_graph(const std::vector<std::vector<Edge>> &graph, const StarIdTable &ids) {
+    CsrGraph csr;
+    csr.names = ids.names;
+    int n = static_cast<int>(graph.size());
+    csr.offsets.assign(n + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        csr.offsets[i + 1] = csr.offsets[i] + static_cast<int>(graph[i].size());
+    }
+
+    csr.targets.resize(csr.offsets.back());
+    csr.distances.resize(csr.offsets.back());
+    for (int i = 0; i < n; ++i) {
+        int slot = csr.offsets[i];
+        for (const auto &edge : graph[i]) {
+            csr.targets[slot] = edge.to;
+            csr.distances[slot] = edge.distance;
+            ++slot;
+        }
+    }
+
+    return csr;
+}
+
+// Function to copy a binary snapshot into a CsrGraph; the arrays are already in CSR order so this is a bulk copy
+CsrGraph build_csr_graph(const GraphSnapshot &snapshot) {
+    CsrGraph csr;
+    csr.names.reserve(snapshot.star_count);
+    for (uint64_t i = 0; i < snapshot.star_count; ++i) {
+        csr.names.push_back(snapshot_star_name(snapshot, i));
+    }
+    csr.offsets.assign(snapshot.offsets, snapshot.offsets + snapshot.star_count + 1);
+    csr.targets.assign(snapshot.targets, snapshot.targets + 2 * snapshot.route_count);
+    csr.distances.assign(snapshot.distances, snapshot.distances + 2 * snapshot.route_count);
+    return csr;
+}
+
+// Function to look up the id of a star by a linear scan, -1 if the star is not in the graph
+// For repeated lookups build a StarIdTable from csr.names instead
+int find_star_index(const CsrGraph &csr, const std::string &name) {
+    auto it = std::find(csr.names.begin(), csr.names.end(), name);
+    if (it == csr.names.end()) {
+        return -1;
+    }
+    return static_cast<int>(it - csr.names.begin());
+}
+
+// Function to generate a random connected star graph for benchmarking
+// Stars get random coordinates and routes join nearby stars, like the regional maps the dataset models
+// Every route length is the Euclidean distance between its endpoints; coordinates receives x, y, z per star if given
+// Generated stars are named #0, #1, ... after their ids
+CsrGraph generate_random_csr_graph(int star_count, int route_count, unsigned int seed, std::vector<double> *coordinates = nullptr) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::uniform_int_distribution<int> pick(0, star_count - 1);
+    std::uniform_int_distribution<int> nearby(1, 32);
+
+    std::vector<double> x(star_count), y(star_count), z(star_count);
+    for (int i = 0; i < star_count; ++i) {
+        x[i] = coordinate(rng);
+        y[i] = coordinate(rng);
+        z[i] = coordinate(rng);
+    }
+
+    // Order stars along a Morton (Z-order) curve so neighbours in the order are neighbours in space
+    auto morton = [](double value) {
+        unsigned long long cell = static_cast<unsigned long long>(value / 1000.0 * 1023.0), spread = 0;
+        for (int bit = 0; bit < 10; ++bit) {
+            spread |= ((cell >> bit) & 1ULL) << (3 * bit);
+        }
+        return spread;
+    };
+    std::vector<std::pair<unsigned long long, int>> keyed(star_count);
+    for (int i = 0; i < star_count; ++i) {
+        keyed[i] = {morton(x[i]) | (morton(y[i]) << 1) | (morton(z[i]) << 2), i};
+    }
+    std::sort(keyed.begin(), keyed.end());
+
+    // A path along the curve keeps the graph connected, the remaining routes join stars close on the curve
+    std::vector<std::pair<int, int>> routes;
+    for (int i = 1; i < star_count && static_cast<int>(routes.size()) < route_count; ++i) {
+        routes.push_back({keyed[i - 1].second, keyed[i].second});
+    }
+    while (static_cast<int>(routes.size()) < route_count) {
+        int position = pick(rng);
+        int other = position + nearby(rng);
+        if (other < star_count) {
+            routes.push_back({keyed[position].second, keyed[other].second});
+        }
+    }
+
+    if (coordinates != nullptr) {
+        coordinates->clear();
+        for (int i = 0; i < star_count; ++i) {
+            coordinates->insert(coordinates->end(), {x[i], y[i], z[i]});
+        }
+    }
+
+    CsrGraph csr;
+    csr.names.resize(star_count);
+    for (int i = 0; i < star_count; ++i) {
+        csr.names[i] = "#" + std::to_string(i);
+    }
+    csr.offsets.assign(star_count + 1, 0);
+    for (const auto &route : routes) {
+        ++csr.offsets[route.first + 1];
+        ++csr.offsets[route.second + 1];
+    }
+    for (int i = 0; i < star_count; ++i) {
+        csr.offsets[i + 1] += csr.offsets[i];
+    }
+
+    std::vector<int> cursor(csr.offsets.begin(), csr.offsets.end() - 1);
+    csr.targets.resize(csr.offsets.back());
+    csr.distances.resize(csr.offsets.back());
+    for (const auto &route : routes) {
+        int a = route.first, b = route.second;
+        double distance = dijkstra_calculate_distance(x[a], y[a], z[a], x[b], y[b], z[b]);
+        csr.targets[cursor[a]] = b;
+        csr.distances[cursor[a]++] = distance;
+        csr.targets[cursor[b]] = a;
+        csr.distances[cursor[b]++] = distance;
+    }
+
+    return csr;
+}
+
+// Function to run Dijkstra's algorithm on a CsrGraph, returns the distance to every star
+std::vector<double> csr_dijkstra(const CsrGraph &csr, int start) {
+    std::vector<double> distances(csr.star_count(), std::numeric_limits<double>::infinity());
+    std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+    distances[start] = 0;
+    pq.push({0, start});
+
+    while (!pq.empty()) {
+        double current_distance = pq.top().first;
+        int current = pq.top().second;
+        pq.pop();
+
+        if (current_distance > distances[current]) {
+            continue;
+        }
+
+        for (int e = csr.offsets[current]; e < csr.offsets[current + 1]; ++e) {
+            double new_distance = current_distance + csr.distances[e];
+            if (new_distance < distances[csr.targets[e]]) {
+                distances[csr.targets[e]] = new_distance;
+                pq.push({new_distance, csr.targets[e]});
+            }
+        }
+    }
+
+    return distances;
+}
+
+#endif // CSR_GRAPH_H
@@ -0,0 +1,139 @@
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include <vector>
+#include <map>
+#include <atomic>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include "csr_graph.h"
+#include "thread_pool.h"
+
+// Function to lower an atomic distance, returns true if this call made it smaller
+bool atomic_min_distance(std::atomic<double> &target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (value < current) {
+        if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Function to compute single-source shortest paths with delta-stepping (Meyer and Sanders)
+// Stars are kept in buckets of width delta; all stars of the lowest bucket are relaxed in parallel,
+// light routes (<= delta) repeatedly until the bucket stays empty, then heavy routes once
+// Only non-empty buckets are stored, in an ordered map from bucket index to stars, so a small delta costs
+// map lookups rather than a vector of (longest distance / delta) buckets walked one by one
+// Gives the same distances as dijkstra() for any delta accepted by valid_delta()
+std::vector<double> delta_stepping(const CsrGraph &csr, int start, double delta, ThreadPool &pool) {
+    int n = csr.star_count();
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<std::atomic<double>> distances(n);
+    for (auto &distance : distances) {
+        distance.store(infinity, std::memory_order_relaxed);
+    }
+    distances[start].store(0, std::memory_order_relaxed);
+
+    std::map<size_t, std::vector<int>> buckets = {{0, {start}}};
+    size_t cached_index = SIZE_MAX;                      // the bucket last inserted into, most improved stars share it
+    std::vector<int> *cached_bucket = nullptr;
+    std::vector<std::vector<int>> improved(pool.size()); // per-thread stars whose distance dropped
+    std::vector<int> last_phase(n, -1);                  // dedupes a star listed twice in one bucket
+    int phase = 0;
+
+    auto bucket_of = [delta](double distance) { return static_cast<size_t>(distance / delta); };
+
+    // Relax the light or heavy routes out of every star in frontier, collecting improved stars per thread
+    // Small frontiers are relaxed on the calling thread, waking the pool would cost more than the work
+    auto relax = [&](const std::vector<int> &frontier, bool light) {
+        auto body = [&](int begin, int end, int t) {
+            for (int i = begin; i < end; ++i) {
+                int current = frontier[i];
+                double current_distance = distances[current].load(std::memory_order_relaxed);
+                for (int e = csr.offsets[current]; e < csr.offsets[current + 1]; ++e) {
+                    if ((csr.distances[e] <= delta) != light) {
+                        continue;
+                    }
+                    if (atomic_min_distance(distances[csr.targets[e]], current_distance + csr.distances[e])) {
+                        improved[t].push_back(csr.targets[e]);
+                    }
+                }
+            }
+        };
+        if (frontier.size() < 1024) {
+            body(0, static_cast<int>(frontier.size()), 0);
+        } else {
+            pool.parallel_for(static_cast<int>(frontier.size()), body);
+        }
+
+        // Move improved stars into the bucket matching their new distance
+        for (auto &list : improved) {
+            for (int star : list) {
+                size_t index = bucket_of(distances[star].load(std::memory_order_relaxed));
+                if (index != cached_index) {
+                    cached_index = index;
+                    cached_bucket = &buckets[index];
+                }
+                cached_bucket->push_back(star);
+            }
+            list.clear();
+        }
+    };
+
+    std::vector<int> frontier, settled;
+    while (!buckets.empty()) {
+        // Relaxing a star never lowers another below the star's own bucket, so the lowest bucket is the next one
+        auto bucket = buckets.begin();
+        size_t current_bucket = bucket->first;
+        settled.clear();
+        while (!bucket->second.empty()) {
+            // Keep only stars that still belong to this bucket, once each per phase
+            frontier.clear();
+            for (int star : bucket->second) {
+                if (last_phase[star] != phase && bucket_of(distances[star].load(std::memory_order_relaxed)) == current_bucket) {
+                    last_phase[star] = phase;
+                    frontier.push_back(star);
+                }
+            }
+            bucket->second.clear();
+            ++phase;
+
+            settled.insert(settled.end(), frontier.begin(), frontier.end());
+            relax(frontier, true);
+        }
+        buckets.erase(bucket);
+        cached_index = SIZE_MAX;
+        relax(settled, false);
+    }
+
+    std::vector<double> result(n);
+    for (int star = 0; star < n; ++star) {
+        result[star] = distances[star].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+// Function to tell whether delta is a usable bucket width for this graph
+// Bucket indices are distance / delta; no shortest distance exceeds the longest route times (stars - 1), and
+// keeping that over delta within 2^52 keeps every index an exact integer
+bool valid_delta(const CsrGraph &csr, double delta) {
+    if (!(delta > 0) || std::isinf(delta)) {
+        return false;
+    }
+    double longest = csr.edge_count() == 0 ? 0 : *std::max_element(csr.distances.begin(), csr.distances.end());
+    return longest * std::max(1, csr.star_count() - 1) / delta <= 4503599627370496.0;
+}
+
+// Function to pick a bucket width from the graph: the longest route divided by the average degree (Meyer and Sanders)
+double default_delta(const CsrGraph &csr) {
+    if (csr.edge_count() == 0) {
+        return 1.0;
+    }
+    double longest = *std::max_element(csr.distances.begin(), csr.distances.end());
+    double average_degree = static_cast<double>(csr.edge_count()) / std::max(1, csr.star_count());
+    return std::max(1e-9, longest / std::max(1.0, average_degree));
+}
+
+#endif // DELTA_STEPPING_H
@@ -0,0 +1,74 @@
+// Build: g++ -O2 -std=c++17 -pthread -I../../common delta_stepping_bench.cpp -o delta_stepping_bench.exe
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include "dijkstra_operations.h"
+#include "csr_graph.h"
+#include "delta_stepping.h"
+
+// Function to count stars whose distances differ between two runs
+int count_mismatches(const std::vector<double> &expected, const std::vector<double> &actual) {
+    int mismatches = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (expected[i] != actual[i] && std::abs(expected[i] - actual[i]) > 1e-9 * std::max(1.0, expected[i])) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: delta_stepping_bench [star_count route_count [delta [max_threads]]]
+    // Check against dijkstra() on the star dataset first
+    std::vector<DijkstraStar> stars;
+    std::vector<std::vector<Edge>> graph;
+    StarIdTable ids;
+    read_star_dataset("dataset2_1.txt", stars, graph, ids);
+    if (!graph.empty()) {
+        CsrGraph csr = build_csr_graph(graph, ids);
+        std::vector<PathInfo> distances = dijkstra(graph, ids.find("A"));
+        ThreadPool pool(2);
+        std::vector<double> parallel = delta_stepping(csr, ids.find("A"), default_delta(csr), pool);
+        int mismatches = 0;
+        for (int star = 0; star < csr.star_count(); ++star) {
+            if (std::abs(distances[star].distance - parallel[star]) > 1e-9) {
+                ++mismatches;
+            }
+        }
+        std::cout << "dataset2_1.txt: " << mismatches << " mismatches against dijkstra() from Star A" << std::endl;
+    }
+
+    int star_count = argc >= 3 ? std::atoi(argv[1]) : 1000000;
+    int route_count = argc >= 3 ? std::atoi(argv[2]) : 3000000;
+    CsrGraph csr = generate_random_csr_graph(star_count, route_count, 7);
+    double delta = argc >= 4 && std::atof(argv[3]) != 0 ? std::atof(argv[3]) : default_delta(csr); // 0 picks the default
+    if (!valid_delta(csr, delta)) {
+        std::cerr << "Invalid delta: " << argv[3] << " (expected a width above 0 that splits the longest path into at most 2^52 buckets)" << std::endl;
+        return 1;
+    }
+    int max_threads = argc >= 5 ? std::atoi(argv[4]) : std::max(1u, std::thread::hardware_concurrency());
+
+    auto start_time = std::chrono::steady_clock::now();
+    std::vector<double> expected = csr_dijkstra(csr, 0);
+    double sequential = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    std::cout << "Stars: " << star_count << ", routes: " << route_count << ", delta: " << delta << std::endl;
+    std::cout << "Sequential Dijkstra: " << sequential << " seconds" << std::endl;
+
+    // Report speedup over sequential Dijkstra for doubling thread counts, finishing with max_threads
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (int threads : thread_counts) {
+        ThreadPool pool(threads);
+        start_time = std::chrono::steady_clock::now();
+        std::vector<double> parallel = delta_stepping(csr, 0, delta, pool);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        std::cout << "Delta-stepping, " << threads << " threads: " << seconds << " seconds, speedup " << sequential / seconds
+                  << ", mismatches " << count_mismatches(expected, parallel) << std::endl;
+    }
+
+    return 0;
+}
@@ -11,24 +11,26 @@
 #include <limits>
 #include <cmath>
 #include <algorithm>
+#include "star_ids.h"
+#include "graph_snapshot.h"
 
 // Define DijkstraStar struct
 struct DijkstraStar {
-    char name;
+    std::string name;
     double x, y, z; // x-axis, y-axis, z-axis
     int weight, profit;
 };
 
 // Define Edge struct for graph representation
 struct Edge {
-    char to; // star destination
+    int32_t to; // star destination id
     double distance;
 };
 
-// Define PathInfo struct to store distance and path
+// Define PathInfo struct to store distance and the previous star on the path
 struct PathInfo {
     double distance;
-    std::vector<char> path;
+    int32_t parent; // -1 for the start and unreachable stars
 };
 
 // Function to calculate distance between two DijkstraStars
@@ -37,58 +39,76 @@ double dijkstra_calculate_distance(double x1, double y1, double z1, double x2, d
 }
 
 // Function to read star dataset for Dijkstra's algorithm
-void read_star_dataset(const std::string &filename, std::vector<DijkstraStar> &stars, std::unordered_map<char, std::vector<Edge>> &graph) {
+// Stars get ids in file order (stars[id], graph[id]); ids maps names to ids. A route naming an undeclared star is skipped
+void read_star_dataset(const std::string &filename, std::vector<DijkstraStar> &stars, std::vector<std::vector<Edge>> &graph, StarIdTable &ids) {
     std::ifstream infile(filename);
     if (!infile.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
         return;
     }
 
-    std::string line;
+    std::string line, from, to;
     while (std::getline(infile, line)) {
-        std::istringstream iss(line);
-        std::string type;
-        iss >> type;
-
-        if (type == "Star") {
-            DijkstraStar star;
-            iss >> star.name >> star.x >> star.y >> star.z >> star.weight >> star.profit;
-            stars.push_back(star);
-        } else if (type == "Route") {
-            char from, to;
-            std::string delimiter;
-            double distance;
-            iss >> from >> delimiter >> to >> delimiter >> distance;
-            graph[from].push_back({to, distance});
-            graph[to].push_back({from, distance}); 
+        DijkstraStar star;
+        double distance;
+        if (parse_star_line(line, star.name, star.x, star.y, star.z, star.weight, star.profit)) {
+            if (ids.find(star.name) < 0) {
+                ids.intern(star.name);
+                stars.push_back(star);
+                graph.emplace_back();
+            }
+        } else if (parse_route_line(line, from, to, distance)) {
+            int32_t a = ids.find(from), b = ids.find(to);
+            if (a < 0 || b < 0) {
+                continue;
+            }
+            graph[a].push_back({b, distance});
+            graph[b].push_back({a, distance});
         }
     }
 
     infile.close();
 }
 
-// Function to apply Dijkstra's Algorithm
-std::unordered_map<char, PathInfo> dijkstra(const std::unordered_map<char, std::vector<Edge>> &graph, char start) {
-    // Store shortest distance and path from start star to other stars
-    std::unordered_map<char, PathInfo> distances;
-    for (const auto &node : graph) {
-        // Stars unreachable from start
-        distances[node.first] = {std::numeric_limits<double>::infinity(), {}};
+// Function to fill the same star list and adjacency lists as read_star_dataset from a binary snapshot
+void read_star_snapshot(const std::string &filename, std::vector<DijkstraStar> &stars, std::vector<std::vector<Edge>> &graph, StarIdTable &ids) {
+    GraphSnapshot snapshot;
+    if (!open_graph_snapshot(filename, snapshot)) {
+        return;
+    }
+
+    stars.reserve(snapshot.star_count);
+    graph.resize(snapshot.star_count);
+    for (uint64_t i = 0; i < snapshot.star_count; ++i) {
+        stars.push_back({snapshot_star_name(snapshot, i), snapshot.x[i], snapshot.y[i], snapshot.z[i], snapshot.weight[i], snapshot.profit[i]});
+        ids.intern(stars.back().name);
+        for (int64_t e = snapshot.offsets[i]; e < snapshot.offsets[i + 1]; ++e) {
+            graph[i].push_back({snapshot.targets[e], snapshot.distances[e]});
+        }
     }
+
+    close_graph_snapshot(snapshot);
+}
+
+// Function to apply Dijkstra's Algorithm, returns the distance and parent of every star indexed by id
+// Paths are kept as parent links and rebuilt by dijkstra_path() when written, so a relaxation is O(1)
+std::vector<PathInfo> dijkstra(const std::vector<std::vector<Edge>> &graph, int32_t start) {
+    // Store shortest distance and parent from start star to other stars; unreachable stars keep infinity
+    std::vector<PathInfo> distances(graph.size(), {std::numeric_limits<double>::infinity(), -1});
     // Set distance from start to itself as 0
-    distances[start] = {0, {start}};
+    distances[start] = {0, -1};
 
-    // Compare star (char) and distances (double)
-    auto compare = [](const std::pair<char, double> &a, const std::pair<char, double> &b) {
+    // Compare star (id) and distances (double)
+    auto compare = [](const std::pair<int32_t, double> &a, const std::pair<int32_t, double> &b) {
         return a.second > b.second;
     };
-    std::priority_queue<std::pair<char, double>, std::vector<std::pair<char, double>>, decltype(compare)> pq(compare);
+    std::priority_queue<std::pair<int32_t, double>, std::vector<std::pair<int32_t, double>>, decltype(compare)> pq(compare);
     pq.push({start, 0});
 
     // Iterate until pq is empty
     while (!pq.empty()) {
         // Retrieve star with smallest distance from pq
-        char current = pq.top().first; 
+        int32_t current = pq.top().first;
         double current_distance = pq.top().second;
         pq.pop();
 
@@ -97,12 +117,10 @@ std::unordered_map<char, PathInfo> dijkstra(const std::unordered_map<char, std::
             continue;
         }
 
-        for (const auto &edge : graph.at(current)) {
+        for (const auto &edge : graph[current]) {
             double new_distance = current_distance + edge.distance;
             if (new_distance < distances[edge.to].distance) {
-                distances[edge.to].distance = new_distance;
-                distances[edge.to].path = distances[current].path;
-                distances[edge.to].path.push_back(edge.to);
+                distances[edge.to] = {new_distance, current};
                 pq.push({edge.to, new_distance});
             }
         }
@@ -111,18 +129,37 @@ std::unordered_map<char, PathInfo> dijkstra(const std::unordered_map<char, std::
     return distances;
 }
 
+// Function to rebuild the path from the start to star by following parents; empty if star is unreachable
+std::vector<int32_t> dijkstra_path(const std::vector<PathInfo> &distances, int32_t star) {
+    std::vector<int32_t> path;
+    if (std::isinf(distances[star].distance)) {
+        return path;
+    }
+    for (int32_t current = star; current >= 0; current = distances[current].parent) {
+        path.push_back(current);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
 // Function to save distances and paths to a file
-void save_distances(const std::unordered_map<char, PathInfo> &distances, const std::string &filename) {
+void save_distances(const std::vector<PathInfo> &distances, const StarIdTable &ids, int32_t start, const std::string &filename) {
     std::ofstream outfile(filename);
     if (!outfile.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
         return;
     }
 
-    for (const auto &entry : distances) {
-        outfile << "Shortest distance from Star A to Star " << entry.first << " is " << entry.second.distance << ", path: {";
-        for (const auto &star : entry.second.path) {
-            outfile << star << (star == entry.second.path.back() ? "" : ", ");
+    for (size_t star = 0; star < distances.size(); ++star) {
+        const PathInfo &info = distances[star];
+        if (std::isinf(info.distance)) {
+            outfile << "Star " << ids.names[star] << " is unreachable from Star " << ids.names[start] << "." << std::endl;
+            continue;
+        }
+        std::vector<int32_t> path = dijkstra_path(distances, star);
+        outfile << "Shortest distance from Star " << ids.names[start] << " to Star " << ids.names[star] << " is " << info.distance << ", path: {";
+        for (size_t i = 0; i < path.size(); ++i) {
+            outfile << ids.names[path[i]] << (i + 1 == path.size() ? "" : ", ");
         }
         outfile << "}" << std::endl;
     }
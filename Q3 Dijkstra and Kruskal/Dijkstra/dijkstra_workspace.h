@@ -0,0 +1,28 @@
+#ifndef DIJKSTRA_WORKSPACE_H
+#define DIJKSTRA_WORKSPACE_H
+
+#include <vector>
+#include <limits>
+#include <utility>
+
+// Define DijkstraWorkspace struct: search state allocated once and reused across queries
+// Only the stars a query touched are reset afterwards, so a small query costs what it visits
+struct DijkstraWorkspace {
+    std::vector<double> distance;
+    std::vector<bool> settled;
+    std::vector<int> touched;
+    std::vector<std::pair<double, int>> heap;
+
+    explicit DijkstraWorkspace(int star_count) : distance(star_count, std::numeric_limits<double>::infinity()), settled(star_count, false) {}
+
+    void reset() {
+        for (int star : touched) {
+            distance[star] = std::numeric_limits<double>::infinity();
+            settled[star] = false;
+        }
+        touched.clear();
+        heap.clear();
+    }
+};
+
+#endif // DIJKSTRA_WORKSPACE_H
@@ -0,0 +1,207 @@
+#ifndef DYNAMIC_SHORTEST_PATHS_H
+#define DYNAMIC_SHORTEST_PATHS_H
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include "csr_graph.h"
+
+// Define DynamicArc struct: one direction of a two-way route in the editable graph
+struct DynamicArc {
+    int to;
+    double distance;
+};
+
+// Define DynamicShortestPaths struct
+// Keeps the shortest path tree from one source and repairs only the part an edit affects (Ramalingam and Reps)
+struct DynamicShortestPaths {
+    int source;
+    std::vector<std::vector<DynamicArc>> arcs;
+    std::vector<double> distance;
+    std::vector<int> parent;                 // -1 for the source and unreachable stars
+    std::vector<std::vector<int>> children;
+    long long last_update_work = 0;          // stars and arcs touched by the most recent edit
+
+    DynamicShortestPaths(const CsrGraph &csr, int source_star) : source(source_star), arcs(csr.star_count()) {
+        for (int u = 0; u < csr.star_count(); ++u) {
+            for (int e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+                arcs[u].push_back({csr.targets[e], csr.distances[e]});
+            }
+        }
+        distance.assign(arcs.size(), std::numeric_limits<double>::infinity());
+        parent.assign(arcs.size(), -1);
+        children.assign(arcs.size(), {});
+        distance[source] = 0;
+        propagate_decrease({source});
+    }
+
+    // Function to add a new two-way route
+    void insert_route(int u, int v, double route_distance) {
+        last_update_work = 0;
+        arcs[u].push_back({v, route_distance});
+        arcs[v].push_back({u, route_distance});
+        relax_route(u, v, route_distance);
+    }
+
+    // Function to remove one route between u and v (the shortest if several exist), returns false if there is none
+    bool remove_route(int u, int v) {
+        last_update_work = 0;
+        int slot_u = find_arc(u, v), slot_v = find_arc(v, u);
+        if (slot_u < 0 || slot_v < 0) {
+            return false;
+        }
+        arcs[u].erase(arcs[u].begin() + slot_u);
+        arcs[v].erase(arcs[v].begin() + slot_v);
+        repair_after_increase(u, v);
+        return true;
+    }
+
+    // Function to change the length of the shortest route between u and v, returns false if there is none
+    bool set_route_distance(int u, int v, double route_distance) {
+        last_update_work = 0;
+        int slot_u = find_arc(u, v), slot_v = find_arc(v, u);
+        if (slot_u < 0 || slot_v < 0) {
+            return false;
+        }
+        double old_distance = arcs[u][slot_u].distance;
+        arcs[u][slot_u].distance = route_distance;
+        arcs[v][slot_v].distance = route_distance;
+        if (route_distance < old_distance) {
+            relax_route(u, v, route_distance);
+        } else if (route_distance > old_distance) {
+            repair_after_increase(u, v);
+        }
+        return true;
+    }
+
+private:
+    int find_arc(int from, int to) const {
+        int best = -1;
+        for (int i = 0; i < static_cast<int>(arcs[from].size()); ++i) {
+            if (arcs[from][i].to == to && (best < 0 || arcs[from][i].distance < arcs[from][best].distance)) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    void set_parent(int star, int new_parent) {
+        if (parent[star] >= 0) {
+            std::vector<int> &siblings = children[parent[star]];
+            siblings.erase(std::find(siblings.begin(), siblings.end(), star));
+        }
+        parent[star] = new_parent;
+        if (new_parent >= 0) {
+            children[new_parent].push_back(star);
+        }
+    }
+
+    // A shorter or new route can only help the far end, the improvement then spreads like Dijkstra
+    void relax_route(int u, int v, double route_distance) {
+        std::vector<int> improved;
+        if (distance[u] + route_distance < distance[v]) {
+            distance[v] = distance[u] + route_distance;
+            set_parent(v, u);
+            improved.push_back(v);
+        } else if (distance[v] + route_distance < distance[u]) {
+            distance[u] = distance[v] + route_distance;
+            set_parent(u, v);
+            improved.push_back(u);
+        }
+        propagate_decrease(improved);
+    }
+
+    // Dijkstra seeded with the stars whose distance just dropped; stops where nothing improves
+    void propagate_decrease(const std::vector<int> &seeds) {
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+        for (int star : seeds) {
+            pq.push({distance[star], star});
+        }
+        while (!pq.empty()) {
+            double current_distance = pq.top().first;
+            int current = pq.top().second;
+            pq.pop();
+            if (current_distance > distance[current]) {
+                continue;
+            }
+            ++last_update_work;
+            for (const auto &arc : arcs[current]) {
+                ++last_update_work;
+                if (current_distance + arc.distance < distance[arc.to]) {
+                    distance[arc.to] = current_distance + arc.distance;
+                    set_parent(arc.to, current);
+                    pq.push({distance[arc.to], arc.to});
+                }
+            }
+        }
+    }
+
+    // A longer or removed route only matters if it was a tree route; then the subtree below it is
+    // detached, each detached star takes its best distance through an undetached neighbour, and a
+    // Dijkstra restricted to the detached stars settles the rest
+    void repair_after_increase(int u, int v) {
+        int child = parent[v] == u ? v : parent[u] == v ? u : -1;
+        if (child < 0) {
+            return;
+        }
+        int up = parent[child];
+        int slot = find_arc(up, child);
+        if (slot >= 0 && distance[up] + arcs[up][slot].distance == distance[child]) {
+            return; // A parallel route of the same length keeps the tree valid
+        }
+
+        std::vector<int> affected;
+        std::vector<int> stack = {child};
+        while (!stack.empty()) {
+            int star = stack.back();
+            stack.pop_back();
+            affected.push_back(star);
+            for (int next : children[star]) {
+                stack.push_back(next);
+            }
+        }
+        for (int star : affected) {
+            distance[star] = std::numeric_limits<double>::infinity();
+        }
+        for (int star : affected) {
+            set_parent(star, -1);
+        }
+
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+        for (int star : affected) {
+            ++last_update_work;
+            for (const auto &arc : arcs[star]) {
+                ++last_update_work;
+                double through = distance[arc.to] + arc.distance;
+                if (through < distance[star]) {
+                    distance[star] = through;
+                    set_parent(star, arc.to);
+                }
+            }
+            if (distance[star] != std::numeric_limits<double>::infinity()) {
+                pq.push({distance[star], star});
+            }
+        }
+
+        // Only detached stars can improve: every other distance is unchanged and already optimal
+        while (!pq.empty()) {
+            double current_distance = pq.top().first;
+            int current = pq.top().second;
+            pq.pop();
+            if (current_distance > distance[current]) {
+                continue;
+            }
+            for (const auto &arc : arcs[current]) {
+                ++last_update_work;
+                if (current_distance + arc.distance < distance[arc.to]) {
+                    distance[arc.to] = current_distance + arc.distance;
+                    set_parent(arc.to, current);
+                    pq.push({distance[arc.to], arc.to});
+                }
+            }
+        }
+    }
+};
+
+#endif // DYNAMIC_SHORTEST_PATHS_H
@@ -0,0 +1,88 @@
+// Build: g++ -O2 -std=c++17 -I../../common dynamic_updates.cpp -o dynamic_updates.exe
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "dijkstra_operations.h"
+#include "csr_graph.h"
+#include "dynamic_shortest_paths.h"
+
+// Function to rebuild a CsrGraph from the editable graph so a full rerun can check the repaired tree
+CsrGraph snapshot_graph(const DynamicShortestPaths &paths) {
+    CsrGraph csr;
+    csr.names.assign(paths.arcs.size(), "");
+    csr.offsets.assign(paths.arcs.size() + 1, 0);
+    for (size_t u = 0; u < paths.arcs.size(); ++u) {
+        for (const auto &arc : paths.arcs[u]) {
+            csr.targets.push_back(arc.to);
+            csr.distances.push_back(arc.distance);
+        }
+        csr.offsets[u + 1] = static_cast<int>(csr.targets.size());
+    }
+    return csr;
+}
+
+// Function to count stars whose repaired distance differs from a full rerun
+int count_mismatches(const DynamicShortestPaths &paths) {
+    std::vector<double> expected = csr_dijkstra(snapshot_graph(paths), paths.source);
+    int mismatches = 0;
+    for (size_t star = 0; star < expected.size(); ++star) {
+        if (expected[star] != paths.distance[star] && std::abs(expected[star] - paths.distance[star]) > 1e-9 * std::max(1.0, expected[star])) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: dynamic_updates [star_count route_count update_count] -- without arguments the star dataset is edited
+    CsrGraph csr;
+    if (argc >= 4) {
+        csr = generate_random_csr_graph(std::atoi(argv[1]), std::atoi(argv[2]), 7);
+    } else {
+        std::vector<DijkstraStar> stars;
+        std::vector<std::vector<Edge>> graph;
+        StarIdTable ids;
+        read_star_dataset("dataset2_1.txt", stars, graph, ids);
+        csr = build_csr_graph(graph, ids);
+    }
+    int update_count = argc >= 4 ? std::atoi(argv[3]) : 1000;
+    int source = std::max(0, find_star_index(csr, "A"));
+
+    auto start_time = std::chrono::steady_clock::now();
+    DynamicShortestPaths paths(csr, source);
+    double full_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    // Apply a random mix of route insertions, removals and reweights
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> pick(0, csr.star_count() - 1);
+    std::uniform_real_distribution<double> length(1.0, 1000.0);
+    double update_seconds = 0;
+    long long total_work = 0;
+    for (int i = 0; i < update_count; ++i) {
+        int u = pick(rng);
+        int kind = i % 3;
+        auto start_update = std::chrono::steady_clock::now();
+        if (kind == 0 || paths.arcs[u].empty()) {
+            int v = pick(rng);
+            if (v != u) {
+                paths.insert_route(u, v, length(rng));
+            }
+        } else if (kind == 1) {
+            paths.remove_route(u, paths.arcs[u][rng() % paths.arcs[u].size()].to);
+        } else {
+            const DynamicArc &arc = paths.arcs[u][rng() % paths.arcs[u].size()];
+            paths.set_route_distance(u, arc.to, arc.distance * std::uniform_real_distribution<double>(0.5, 2.0)(rng));
+        }
+        update_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_update).count();
+        total_work += paths.last_update_work;
+    }
+
+    std::cout << "Stars: " << csr.star_count() << ", routes: " << csr.edge_count() / 2 << std::endl;
+    std::cout << "Full shortest path tree: " << full_seconds * 1e6 << " microseconds" << std::endl;
+    std::cout << "Average update: " << update_seconds / update_count * 1e6 << " microseconds, average work: "
+              << static_cast<double>(total_work) / update_count << " stars and routes touched" << std::endl;
+    std::cout << "Mismatches against a full rerun: " << count_mismatches(paths) << std::endl;
+
+    return 0;
+}
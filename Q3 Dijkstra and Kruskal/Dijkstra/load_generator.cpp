@@ -0,0 +1,41 @@
+// Build: g++ -O2 -std=c++17 -I../../common load_generator.cpp -o load_generator.exe
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "star_ids.h"
+
+// Writes random requests for query_service to stdout, e.g.
+//   load_generator 100000 20 | query_service 8
+// Sources are drawn from a small hot set most of the time so the cache sees realistic reuse
+
+int main(int argc, char *argv[]) {
+    // Usage: load_generator query_count [star_count] [hot_sources] [indexed]
+    // With "indexed" stars are written as #<index> (generated graphs), otherwise by the dataset names A..Z, AA, AB, ...
+    int query_count = argc >= 2 ? std::atoi(argv[1]) : 10000;
+    int star_count = argc >= 3 ? std::atoi(argv[2]) : 20;
+    int hot_sources = argc >= 4 ? std::atoi(argv[3]) : 4;
+    bool indexed = argc >= 5 && std::string(argv[4]) == "indexed";
+
+    std::mt19937 rng(123);
+    std::uniform_int_distribution<int> any_star(0, star_count - 1);
+    std::uniform_int_distribution<int> hot_star(0, std::max(1, std::min(hot_sources, star_count)) - 1);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    auto label = [indexed](int star) {
+        return indexed ? "#" + std::to_string(star) : generated_star_name(star);
+    };
+
+    for (int q = 0; q < query_count; ++q) {
+        int source = percent(rng) < 80 ? hot_star(rng) : any_star(rng);
+        if (percent(rng) < 90) {
+            std::cout << "PATH " << label(source) << " " << label(any_star(rng)) << "\n";
+        } else {
+            std::cout << "FROM " << label(source) << "\n";
+        }
+    }
+    std::cout << "STATS\nQUIT\n";
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+// Build: g++ -O2 -std=c++17 -I../../common nearest_queries.cpp -o nearest_queries.exe
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include "dijkstra_operations.h"
+#include "csr_graph.h"
+#include "nearest_stars.h"
+
+// Function to time radius and k-nearest queries on a large generated graph against full Dijkstra runs
+void benchmark_nearest(int star_count, int route_count, double radius, int k) {
+    CsrGraph csr = generate_random_csr_graph(star_count, route_count, 7);
+    DijkstraWorkspace workspace(csr.star_count());
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> pick(0, csr.star_count() - 1);
+    const int query_count = 1000;
+
+    double radius_seconds = 0, nearest_seconds = 0;
+    long long radius_found = 0;
+    for (int q = 0; q < query_count; ++q) {
+        int source = pick(rng);
+        auto start_time = std::chrono::steady_clock::now();
+        radius_found += stars_within_radius(csr, workspace, source, radius).size();
+        auto middle_time = std::chrono::steady_clock::now();
+        k_nearest_stars(csr, workspace, source, k);
+        auto end_time = std::chrono::steady_clock::now();
+        radius_seconds += std::chrono::duration<double>(middle_time - start_time).count();
+        nearest_seconds += std::chrono::duration<double>(end_time - middle_time).count();
+    }
+
+    auto start_full = std::chrono::steady_clock::now();
+    csr_dijkstra(csr, pick(rng));
+    double full_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_full).count();
+
+    std::cout << "Stars: " << csr.star_count() << ", routes: " << csr.edge_count() / 2 << std::endl;
+    std::cout << "Within " << radius << ": " << radius_seconds / query_count * 1e6 << " microseconds per query, "
+              << static_cast<double>(radius_found) / query_count << " stars found on average" << std::endl;
+    std::cout << k << " nearest: " << nearest_seconds / query_count * 1e6 << " microseconds per query" << std::endl;
+    std::cout << "Full Dijkstra: " << full_seconds * 1e6 << " microseconds" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: nearest_queries [star] [radius] [k] -- or: nearest_queries bench star_count route_count radius k
+    if (argc >= 6 && std::string(argv[1]) == "bench") {
+        benchmark_nearest(std::atoi(argv[2]), std::atoi(argv[3]), std::atof(argv[4]), std::atoi(argv[5]));
+        return 0;
+    }
+
+    std::vector<DijkstraStar> stars;
+    std::vector<std::vector<Edge>> graph;
+    StarIdTable ids;
+    read_star_dataset("dataset2_1.txt", stars, graph, ids);
+    CsrGraph csr = build_csr_graph(graph, ids);
+
+    std::string name = argc >= 2 ? argv[1] : "A";
+    double radius = argc >= 3 ? std::atof(argv[2]) : 1000;
+    int k = argc >= 4 ? std::atoi(argv[3]) : 5;
+    int source = ids.find(name);
+    if (source < 0) {
+        std::cerr << "Star " << name << " is not in the dataset." << std::endl;
+        return 1;
+    }
+
+    DijkstraWorkspace workspace(csr.star_count());
+    std::cout << "Stars within " << radius << " of Star " << name << ":" << std::endl;
+    for (const auto &entry : stars_within_radius(csr, workspace, source, radius)) {
+        std::cout << "  Star " << csr.names[entry.first] << " at " << entry.second << std::endl;
+    }
+    std::cout << k << " closest stars to Star " << name << ":" << std::endl;
+    for (const auto &entry : k_nearest_stars(csr, workspace, source, k)) {
+        std::cout << "  Star " << csr.names[entry.first] << " at " << entry.second << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#ifndef NEAREST_STARS_H
+#define NEAREST_STARS_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include "csr_graph.h"
+#include "dijkstra_workspace.h"
+
+// Function to run Dijkstra from source, calling visit(star, distance) as each star is settled
+// The search stops as soon as visit returns false
+void bounded_dijkstra(const CsrGraph &csr, DijkstraWorkspace &workspace, int source, const std::function<bool(int, double)> &visit) {
+    auto later = std::greater<std::pair<double, int>>();
+    workspace.distance[source] = 0;
+    workspace.touched.push_back(source);
+    workspace.heap.push_back({0, source});
+
+    while (!workspace.heap.empty()) {
+        std::pop_heap(workspace.heap.begin(), workspace.heap.end(), later);
+        double current_distance = workspace.heap.back().first;
+        int current = workspace.heap.back().second;
+        workspace.heap.pop_back();
+
+        if (workspace.settled[current]) {
+            continue;
+        }
+        workspace.settled[current] = true;
+        if (!visit(current, current_distance)) {
+            break;
+        }
+
+        for (int e = csr.offsets[current]; e < csr.offsets[current + 1]; ++e) {
+            int next = csr.targets[e];
+            double new_distance = current_distance + csr.distances[e];
+            if (new_distance < workspace.distance[next]) {
+                if (workspace.distance[next] == std::numeric_limits<double>::infinity()) {
+                    workspace.touched.push_back(next);
+                }
+                workspace.distance[next] = new_distance;
+                workspace.heap.push_back({new_distance, next});
+                std::push_heap(workspace.heap.begin(), workspace.heap.end(), later);
+            }
+        }
+    }
+
+    workspace.reset();
+}
+
+// Function to find all stars within radius of source by route, nearest first (source included)
+std::vector<std::pair<int, double>> stars_within_radius(const CsrGraph &csr, DijkstraWorkspace &workspace, int source, double radius) {
+    std::vector<std::pair<int, double>> result;
+    bounded_dijkstra(csr, workspace, source, [&](int star, double distance) {
+        if (distance > radius) {
+            return false;
+        }
+        result.push_back({star, distance});
+        return true;
+    });
+    return result;
+}
+
+// Function to find the k stars closest to source by route, nearest first (source excluded)
+std::vector<std::pair<int, double>> k_nearest_stars(const CsrGraph &csr, DijkstraWorkspace &workspace, int source, int k) {
+    std::vector<std::pair<int, double>> result;
+    if (k <= 0) {
+        return result;
+    }
+    bounded_dijkstra(csr, workspace, source, [&](int star, double distance) {
+        if (star != source) {
+            result.push_back({star, distance});
+        }
+        return static_cast<int>(result.size()) < k;
+    });
+    return result;
+}
+
+#endif // NEAREST_STARS_H
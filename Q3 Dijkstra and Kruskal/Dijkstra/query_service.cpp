@@ -0,0 +1,117 @@
+// Build: g++ -O2 -std=c++17 -I../../common query_service.cpp -o query_service.exe
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include <cstdlib>
+#include <cctype>
+#include "dijkstra_operations.h"
+#include "csr_graph.h"
+#include "query_service.h"
+
+// Line protocol, one request per line on stdin, one response line on stdout:
+//   PATH <from> <to>   -> OK <distance> <star> <star> ... | UNREACHABLE
+//   FROM <source>      -> OK <star>:<distance> ...  (unreachable stars are left out)
+//   STATS              -> STATS queries=<n> hits=<n> misses=<n> hit_rate=<r> average_us=<t>
+//   QUIT
+// Every OK/UNREACHABLE response ends with "us=<latency> cache=hit|miss"
+// A star is named by its dataset name, or by #<id> on any graph (generated stars are named that way)
+
+// Function to resolve a star token to its id, -1 if unknown
+// "#<id>" must be all digits after the '#', so "#12x" or "#abc" is an unknown star rather than #12 or #0
+int resolve_star(const StarIdTable &ids, const std::string &token) {
+    int32_t id = ids.find(token);
+    if (id < 0 && token.size() > 1 && token[0] == '#' && std::isdigit(static_cast<unsigned char>(token[1]))) {
+        char *end = nullptr;
+        long index = std::strtol(token.c_str() + 1, &end, 10);
+        return *end == '\0' && index < ids.size() ? static_cast<int>(index) : -1;
+    }
+    return id;
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: query_service [cache_size] [star_count route_count]
+    long cache_size = argc >= 2 ? std::strtol(argv[1], nullptr, 10) : 64;
+    if (cache_size < 1) {
+        std::cerr << "Invalid cache size: " << argv[1] << " (expected 1 or more trees)" << std::endl;
+        return 1;
+    }
+    CsrGraph csr;
+    StarIdTable ids;
+    if (argc >= 4) {
+        csr = generate_random_csr_graph(std::atoi(argv[2]), std::atoi(argv[3]), 7);
+        for (const auto &name : csr.names) {
+            ids.intern(name);
+        }
+    } else {
+        std::vector<DijkstraStar> stars;
+        std::vector<std::vector<Edge>> graph;
+        read_star_dataset("dataset2_1.txt", stars, graph, ids);
+        csr = build_csr_graph(graph, ids);
+    }
+
+    std::ios::sync_with_stdio(false);
+    ShortestPathCache cache(csr, cache_size);
+    long long query_count = 0;
+    double total_seconds = 0;
+    std::string line;
+
+    while (std::getline(std::cin, line)) {
+        std::istringstream iss(line);
+        std::string command, first, second;
+        iss >> command >> first >> second;
+        if (command.empty()) {
+            continue;
+        }
+        if (command == "QUIT") {
+            break;
+        }
+        if (command == "STATS") {
+            std::cout << "STATS queries=" << query_count << " hits=" << cache.hits() << " misses=" << cache.misses()
+                      << " hit_rate=" << cache.hit_rate() << " average_us=" << (query_count ? total_seconds / query_count * 1e6 : 0) << "\n";
+            std::cout.flush();
+            continue;
+        }
+
+        int source = resolve_star(ids, first);
+        int target = command == "PATH" ? resolve_star(ids, second) : 0;
+        if ((command != "PATH" && command != "FROM") || source < 0 || target < 0) {
+            std::cout << "ERROR " << line << "\n";
+            std::cout.flush();
+            continue;
+        }
+
+        auto start_time = std::chrono::steady_clock::now();
+        bool hit = false;
+        const ShortestPathTree &tree = cache.get(source, hit);
+        std::ostringstream response;
+        if (command == "PATH") {
+            std::vector<int> path = tree_path(tree, target);
+            if (path.empty()) {
+                response << "UNREACHABLE";
+            } else {
+                response << "OK " << tree.distance[target];
+                for (int star : path) {
+                    response << " " << csr.names[star];
+                }
+            }
+        } else {
+            response << "OK";
+            for (int star = 0; star < csr.star_count(); ++star) {
+                if (tree.distance[star] != std::numeric_limits<double>::infinity()) {
+                    response << " " << csr.names[star] << ":" << tree.distance[star];
+                }
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        total_seconds += seconds;
+        ++query_count;
+
+        std::cout << response.str() << " us=" << seconds * 1e6 << " cache=" << (hit ? "hit" : "miss") << "\n";
+        std::cout.flush();
+    }
+
+    std::cerr << "Queries: " << query_count << ", cache hit rate: " << cache.hit_rate()
+              << ", average latency: " << (query_count ? total_seconds / query_count * 1e6 : 0) << " microseconds" << std::endl;
+    return 0;
+}
@@ -0,0 +1,99 @@
+#ifndef QUERY_SERVICE_H
+#define QUERY_SERVICE_H
+
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include "csr_graph.h"
+
+// Define ShortestPathTree struct: full single-source answer, enough to rebuild any path from the source
+struct ShortestPathTree {
+    int source;
+    std::vector<double> distance;
+    std::vector<int> parent; // -1 for the source and unreachable stars
+};
+
+// Function to compute the shortest path tree from a source on a CsrGraph
+ShortestPathTree build_shortest_path_tree(const CsrGraph &csr, int source) {
+    ShortestPathTree tree;
+    tree.source = source;
+    tree.distance.assign(csr.star_count(), std::numeric_limits<double>::infinity());
+    tree.parent.assign(csr.star_count(), -1);
+    std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+    tree.distance[source] = 0;
+    pq.push({0, source});
+
+    while (!pq.empty()) {
+        double current_distance = pq.top().first;
+        int current = pq.top().second;
+        pq.pop();
+        if (current_distance > tree.distance[current]) {
+            continue;
+        }
+        for (int e = csr.offsets[current]; e < csr.offsets[current + 1]; ++e) {
+            double new_distance = current_distance + csr.distances[e];
+            if (new_distance < tree.distance[csr.targets[e]]) {
+                tree.distance[csr.targets[e]] = new_distance;
+                tree.parent[csr.targets[e]] = current;
+                pq.push({new_distance, csr.targets[e]});
+            }
+        }
+    }
+
+    return tree;
+}
+
+// Function to read the path from the tree's source to a target, empty if unreachable
+std::vector<int> tree_path(const ShortestPathTree &tree, int target) {
+    std::vector<int> path;
+    if (tree.distance[target] == std::numeric_limits<double>::infinity()) {
+        return path;
+    }
+    for (int star = target; star >= 0; star = tree.parent[star]) {
+        path.push_back(star);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// Define ShortestPathCache class: least-recently-used cache of shortest path trees keyed by source
+class ShortestPathCache {
+public:
+    ShortestPathCache(const CsrGraph &csr, size_t capacity) : csr_(csr), capacity_(std::max<size_t>(1, capacity)) {}
+
+    // Function to get the tree for a source, computing and caching it on a miss
+    const ShortestPathTree &get(int source, bool &hit) {
+        auto it = index_.find(source);
+        hit = it != index_.end();
+        if (hit) {
+            ++hits_;
+            order_.splice(order_.begin(), order_, it->second);
+            return *it->second;
+        }
+
+        ++misses_;
+        if (order_.size() >= capacity_) {
+            index_.erase(order_.back().source);
+            order_.pop_back();
+        }
+        order_.push_front(build_shortest_path_tree(csr_, source));
+        index_[source] = order_.begin();
+        return order_.front();
+    }
+
+    long long hits() const { return hits_; }
+    long long misses() const { return misses_; }
+    double hit_rate() const { return hits_ + misses_ == 0 ? 0 : static_cast<double>(hits_) / (hits_ + misses_); }
+
+private:
+    const CsrGraph &csr_;
+    size_t capacity_;
+    std::list<ShortestPathTree> order_; // most recently used first
+    std::unordered_map<int, std::list<ShortestPathTree>::iterator> index_;
+    long long hits_ = 0, misses_ = 0;
+};
+
+#endif // QUERY_SERVICE_H
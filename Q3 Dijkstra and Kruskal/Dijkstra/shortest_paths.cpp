@@ -1,10 +1,10 @@
+// Build: g++ -O2 -std=c++17 -I../../common shortest_paths.cpp -o shortest_paths.exe
 #include <iostream>
 #include <fstream>
-#include <unordered_map>
 #include <chrono>
 #include "dijkstra_operations.h"
 
-void save_shortest_paths(const std::unordered_map<char, PathInfo>& distances, const std::vector<DijkstraStar>& stars, const std::string& filename) {
+void save_shortest_paths(const std::vector<PathInfo>& distances, const std::vector<DijkstraStar>& stars, int32_t start, const std::string& filename) {
     std::ofstream outfile(filename);
     if (!outfile.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
@@ -12,41 +12,56 @@ void save_shortest_paths(const std::unordered_map<char, PathInfo>& distances, co
     }
 
     // Ensure all stars are included in the output
-    for (const auto& star : stars) {
-        char star_name = star.name;
-        if (distances.find(star_name) != distances.end()) {
-            const auto& info = distances.at(star_name);
-            outfile << "Shortest distance from Star A to Star " << star_name << " is " << info.distance << ", path: {";
-            for (size_t i = 0; i < info.path.size(); ++i) {
-                outfile << info.path[i];
-                if (i < info.path.size() - 1) {
+    const std::string& start_name = stars[start].name;
+    for (size_t star = 0; star < stars.size(); ++star) {
+        const std::string& star_name = stars[star].name;
+        const auto& info = distances[star];
+        if (!std::isinf(info.distance)) {
+            std::vector<int32_t> path = dijkstra_path(distances, star);
+            outfile << "Shortest distance from Star " << start_name << " to Star " << star_name << " is " << info.distance << ", path: {";
+            for (size_t i = 0; i < path.size(); ++i) {
+                outfile << stars[path[i]].name;
+                if (i < path.size() - 1) {
                     outfile << ", ";
                 }
             }
             outfile << "}" << std::endl;
         } else {
-            outfile << "Star " << star_name << " is unreachable from Star A." << std::endl;
+            outfile << "Star " << star_name << " is unreachable from Star " << start_name << "." << std::endl;
         }
     }
 
     outfile.close();
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    // Usage: shortest_paths [dataset] [start star] -- a .snap file is read as a binary snapshot
+    std::string dataset = argc >= 2 ? argv[1] : "dataset2_1.txt";
+    std::string start_name = argc >= 3 ? argv[2] : "A";
     std::vector<DijkstraStar> stars;
-    std::unordered_map<char, std::vector<Edge>> graph;
+    std::vector<std::vector<Edge>> graph;
+    StarIdTable ids;
 
     // Start timing for the entire program
     auto start_program = std::chrono::steady_clock::now();
 
     // Read dataset
-    read_star_dataset("dataset2_1.txt", stars, graph);
+    if (is_snapshot_file(dataset)) {
+        read_star_snapshot(dataset, stars, graph, ids);
+    } else {
+        read_star_dataset(dataset, stars, graph, ids);
+    }
+    int32_t start = ids.find(start_name);
+    if (start < 0) {
+        std::cerr << "Unknown star: " << start_name << std::endl;
+        return 1;
+    }
 
-    // Find shortest paths from Star A
-    std::unordered_map<char, PathInfo> distances = dijkstra(graph, 'A');
+    // Find shortest paths from the start star
+    std::vector<PathInfo> distances = dijkstra(graph, start);
 
     // Save shortest paths to file
-    save_shortest_paths(distances, stars, "shortest_paths.txt");
+    save_shortest_paths(distances, stars, start, "shortest_paths.txt");
 
     // End timing for the entire program
     auto end_program = std::chrono::steady_clock::now();
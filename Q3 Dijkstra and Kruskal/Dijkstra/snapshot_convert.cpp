@@ -0,0 +1,81 @@
+// Build: g++ -O2 -std=c++17 -I../../common snapshot_convert.cpp -o snapshot_convert.exe
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdlib>
+#include "graph_snapshot.h"
+#include "csr_graph.h"
+
+// Function to fill snapshot arrays with a generated graph, for testing startup on large inputs
+void build_snapshot_from_random(int star_count, int route_count, GraphSnapshotData &data) {
+    std::vector<double> coordinates;
+    CsrGraph csr = generate_random_csr_graph(star_count, route_count, 7, &coordinates);
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> two_digits(0, 99);
+
+    for (int i = 0; i < star_count; ++i) {
+        data.names.push_back(csr.names[i]);
+        data.x.push_back(coordinates[3 * i]);
+        data.y.push_back(coordinates[3 * i + 1]);
+        data.z.push_back(coordinates[3 * i + 2]);
+        data.weight.push_back(two_digits(rng));
+        data.profit.push_back(two_digits(rng));
+    }
+    data.offsets.assign(csr.offsets.begin(), csr.offsets.end());
+    data.targets.assign(csr.targets.begin(), csr.targets.end());
+    data.distances = csr.distances;
+
+    // Every route appears in both directions in CSR order; keep the copy leaving the lower index
+    for (int u = 0; u < star_count; ++u) {
+        for (int e = csr.offsets[u]; e < csr.offsets[u + 1]; ++e) {
+            if (u < csr.targets[e]) {
+                data.route_from.push_back(u);
+                data.route_to.push_back(csr.targets[e]);
+                data.route_distance.push_back(csr.distances[e]);
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    // Usage: snapshot_convert dataset2_1.txt dataset2_1.snap
+    //        snapshot_convert --random star_count route_count output.snap
+    GraphSnapshotData data;
+    std::string output;
+    auto start_parse = std::chrono::steady_clock::now();
+    if (argc >= 5 && std::string(argv[1]) == "--random") {
+        build_snapshot_from_random(std::atoi(argv[2]), std::atoi(argv[3]), data);
+        output = argv[4];
+    } else if (argc >= 3) {
+        if (!build_snapshot_from_text(argv[1], data)) {
+            return 1;
+        }
+        output = argv[2];
+    } else {
+        std::cerr << "Usage: snapshot_convert <dataset.txt> <output.snap> | --random <stars> <routes> <output.snap>" << std::endl;
+        return 1;
+    }
+    auto end_parse = std::chrono::steady_clock::now();
+
+    if (!save_graph_snapshot(data, output)) {
+        return 1;
+    }
+    std::cout << "Snapshot saved to " << output << ": " << data.names.size() << " stars, " << data.route_from.size() << " routes" << std::endl;
+    std::cout << "Building arrays: " << std::chrono::duration<double>(end_parse - start_parse).count() * 1e3 << " milliseconds" << std::endl;
+
+    // Reopen to show the startup cost the programs pay when given the snapshot
+    auto start_open = std::chrono::steady_clock::now();
+    GraphSnapshot snapshot;
+    if (!open_graph_snapshot(output, snapshot)) {
+        return 1;
+    }
+    auto end_open = std::chrono::steady_clock::now();
+    CsrGraph csr = build_csr_graph(snapshot);
+    auto end_copy = std::chrono::steady_clock::now();
+    std::cout << "Opening snapshot: " << std::chrono::duration<double>(end_open - start_open).count() * 1e3 << " milliseconds, copying into a CsrGraph: "
+              << std::chrono::duration<double>(end_copy - end_open).count() * 1e3 << " milliseconds" << std::endl;
+    close_graph_snapshot(snapshot);
+
+    return 0;
+}
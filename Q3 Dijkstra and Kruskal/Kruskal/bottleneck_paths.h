@@ -0,0 +1,150 @@
+#ifndef BOTTLENECK_PATHS_H
+#define BOTTLENECK_PATHS_H
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "kruskal.h"
+#include "thread_pool.h"
+
+// Define BottleneckIndex struct: binary lifting tables over a minimum spanning forest
+// The minimax (bottleneck) distance between two stars is the longest hop on their MST path, so after one
+// O(n log n) preprocessing pass each query is an O(log n) climb to the lowest common ancestor.
+// Entry v * levels + k holds v's 2^k-th ancestor and the longest hop on the way up to it.
+struct BottleneckIndex {
+    int vertex_count = 0;
+    int levels = 1;
+    std::vector<int> depth;
+    std::vector<int> tree_root;     // root of the star's tree, so stars in different trees are told apart
+    std::vector<int> ancestor;
+    std::vector<double> longest_hop;
+};
+
+// Function to preprocess a minimum spanning forest for bottleneck queries
+BottleneckIndex build_bottleneck_index(const std::vector<KruskalEdge> &mst, int vertex_count) {
+    BottleneckIndex index;
+    index.vertex_count = vertex_count;
+    while ((1 << index.levels) < vertex_count) {
+        ++index.levels;
+    }
+    const int levels = index.levels;
+
+    // Tree adjacency in CSR form
+    std::vector<int> offsets(vertex_count + 1, 0);
+    for (const auto &edge : mst) {
+        ++offsets[edge.from + 1];
+        ++offsets[edge.to + 1];
+    }
+    for (int v = 0; v < vertex_count; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+    std::vector<int> neighbours(offsets.back());
+    std::vector<double> hops(offsets.back());
+    for (const auto &edge : mst) {
+        neighbours[cursor[edge.from]] = edge.to;
+        hops[cursor[edge.from]++] = edge.distance;
+        neighbours[cursor[edge.to]] = edge.from;
+        hops[cursor[edge.to]++] = edge.distance;
+    }
+
+    // Breadth-first from each tree's root fixes every star's parent before its children are reached
+    index.depth.assign(vertex_count, -1);
+    index.tree_root.assign(vertex_count, -1);
+    index.ancestor.assign(static_cast<size_t>(vertex_count) * levels, 0);
+    index.longest_hop.assign(static_cast<size_t>(vertex_count) * levels, 0);
+    std::vector<int> order;
+    order.reserve(vertex_count);
+    for (int root = 0; root < vertex_count; ++root) {
+        if (index.depth[root] >= 0) {
+            continue;
+        }
+        index.depth[root] = 0;
+        index.tree_root[root] = root;
+        index.ancestor[static_cast<size_t>(root) * levels] = root;
+        size_t head = order.size();
+        order.push_back(root);
+        while (head < order.size()) {
+            int u = order[head++];
+            for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+                int v = neighbours[e];
+                if (index.depth[v] >= 0) {
+                    continue;
+                }
+                index.depth[v] = index.depth[u] + 1;
+                index.tree_root[v] = root;
+                index.ancestor[static_cast<size_t>(v) * levels] = u;
+                index.longest_hop[static_cast<size_t>(v) * levels] = hops[e];
+                order.push_back(v);
+            }
+        }
+    }
+
+    // In BFS order a star's ancestors are complete before the star itself
+    for (int v : order) {
+        size_t base = static_cast<size_t>(v) * levels;
+        for (int k = 1; k < levels; ++k) {
+            int middle = index.ancestor[base + k - 1];
+            size_t middle_base = static_cast<size_t>(middle) * levels;
+            index.ancestor[base + k] = index.ancestor[middle_base + k - 1];
+            index.longest_hop[base + k] = std::max(index.longest_hop[base + k - 1], index.longest_hop[middle_base + k - 1]);
+        }
+    }
+
+    return index;
+}
+
+// Function to find the minimax distance between two stars: the smallest possible longest hop over all paths
+// Returns 0 for the same star and infinity for stars with no path between them
+double bottleneck_distance(const BottleneckIndex &index, int u, int v) {
+    if (u == v) {
+        return 0;
+    }
+    if (index.tree_root[u] != index.tree_root[v]) {
+        return std::numeric_limits<double>::infinity();
+    }
+    const int levels = index.levels;
+    double longest = 0;
+    if (index.depth[u] < index.depth[v]) {
+        std::swap(u, v);
+    }
+
+    // Lift u to v's depth
+    int gap = index.depth[u] - index.depth[v];
+    for (int k = 0; gap > 0; ++k, gap >>= 1) {
+        if (gap & 1) {
+            size_t base = static_cast<size_t>(u) * levels + k;
+            longest = std::max(longest, index.longest_hop[base]);
+            u = index.ancestor[base];
+        }
+    }
+    if (u == v) {
+        return longest;
+    }
+
+    // Lift both to just below their lowest common ancestor
+    for (int k = levels - 1; k >= 0; --k) {
+        size_t base_u = static_cast<size_t>(u) * levels + k, base_v = static_cast<size_t>(v) * levels + k;
+        if (index.ancestor[base_u] != index.ancestor[base_v]) {
+            longest = std::max(longest, std::max(index.longest_hop[base_u], index.longest_hop[base_v]));
+            u = index.ancestor[base_u];
+            v = index.ancestor[base_v];
+        }
+    }
+    size_t base_u = static_cast<size_t>(u) * levels, base_v = static_cast<size_t>(v) * levels;
+    return std::max(longest, std::max(index.longest_hop[base_u], index.longest_hop[base_v]));
+}
+
+// Function to answer many bottleneck queries, split across the pool; results are in query order
+std::vector<double> bottleneck_batch(const BottleneckIndex &index, const std::vector<std::pair<int, int>> &queries, ThreadPool &pool) {
+    std::vector<double> results(queries.size());
+    pool.parallel_for(static_cast<int>(queries.size()), [&](int begin, int end, int) {
+        for (int i = begin; i < end; ++i) {
+            results[i] = bottleneck_distance(index, queries[i].first, queries[i].second);
+        }
+    });
+    return results;
+}
+
+#endif // BOTTLENECK_PATHS_H
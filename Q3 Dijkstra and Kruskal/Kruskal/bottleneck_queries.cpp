@@ -0,0 +1,127 @@
+// Build: g++ -O2 -std=c++17 -pthread -I../../common bottleneck_queries.cpp -o bottleneck_queries.exe
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <queue>
+#include <cstdlib>
+
+#include "kruskal.h"
+#include "bottleneck_paths.h"
+
+// Function to find minimax distances from one star by a search over the whole route list, used as the reference
+std::vector<double> minimax_search(const std::vector<KruskalEdge> &edges, int vertex_count, int source)
+{
+    std::vector<std::vector<std::pair<int, double>>> adjacency(vertex_count);
+    for (const auto &edge : edges) {
+        adjacency[edge.from].push_back({edge.to, edge.distance});
+        adjacency[edge.to].push_back({edge.from, edge.distance});
+    }
+    std::vector<double> best(vertex_count, std::numeric_limits<double>::infinity());
+    std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+    best[source] = 0;
+    pq.push({0, source});
+    while (!pq.empty()) {
+        auto [bottleneck, u] = pq.top();
+        pq.pop();
+        if (bottleneck > best[u]) {
+            continue;
+        }
+        for (const auto &[v, distance] : adjacency[u]) {
+            double through = std::max(bottleneck, distance);
+            if (through < best[v]) {
+                best[v] = through;
+                pq.push({through, v});
+            }
+        }
+    }
+    return best;
+}
+
+// Function to write the bottleneck distance between every pair of stars in the dataset
+void save_bottleneck_table(const BottleneckIndex &index, const StarIdTable &ids, const std::string &filename)
+{
+    std::ofstream outfile(filename);
+    if (!outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return;
+    }
+    for (int u = 0; u < index.vertex_count; ++u) {
+        for (int v = u + 1; v < index.vertex_count; ++v) {
+            outfile << "Stars: " << ids.names[u] << " - " << ids.names[v]
+                    << " Bottleneck Distance: " << bottleneck_distance(index, u, v) << "\n";
+        }
+    }
+    outfile.close();
+    std::cout << "Bottleneck distances saved to " << filename << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: bottleneck_queries [vertex_count edge_count query_count [max_threads]]
+    // The star dataset is answered and checked first, then a generated graph is timed
+    StarIdTable ids;
+    std::vector<KruskalEdge> dataset = read_kruskal_dataset("dataset2_1.txt", ids);
+    if (!dataset.empty()) {
+        BottleneckIndex index = build_bottleneck_index(kruskal(dataset, ids.size()), ids.size());
+        int mismatches = 0;
+        for (int u = 0; u < ids.size(); ++u) {
+            std::vector<double> expected = minimax_search(dataset, ids.size(), u);
+            for (int v = 0; v < ids.size(); ++v) {
+                mismatches += expected[v] != bottleneck_distance(index, u, v);
+            }
+        }
+        std::cout << "dataset2_1.txt: " << mismatches << " mismatches against a minimax search over all routes" << std::endl;
+        save_bottleneck_table(index, ids, "bottleneck_distances.txt");
+    }
+
+    int vertex_count = argc >= 4 ? std::atoi(argv[1]) : 1000000;
+    int edge_count = argc >= 4 ? std::atoi(argv[2]) : 4000000;
+    int query_count = argc >= 4 ? std::atoi(argv[3]) : 4000000;
+    int max_threads = argc >= 5 ? std::atoi(argv[4]) : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<KruskalEdge> edges = generate_random_edges(vertex_count, edge_count, 42);
+    std::vector<KruskalEdge> mst = kruskal(edges, vertex_count);
+
+    auto start_build = std::chrono::high_resolution_clock::now();
+    BottleneckIndex index = build_bottleneck_index(mst, vertex_count);
+    std::chrono::duration<double> build_time = std::chrono::high_resolution_clock::now() - start_build;
+    std::cout << "Vertices: " << vertex_count << ", edges: " << edge_count << ", queries: " << query_count << std::endl;
+    std::cout << "Preprocessing: " << build_time.count() << " seconds, " << index.levels << " levels" << std::endl;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, vertex_count - 1);
+    std::vector<std::pair<int, int>> queries(query_count);
+    for (auto &query : queries) {
+        query = {pick(rng), pick(rng)};
+    }
+
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::vector<double> results;
+    for (int threads : thread_counts) {
+        ThreadPool pool(threads);
+        auto start_time = std::chrono::high_resolution_clock::now();
+        results = bottleneck_batch(index, queries, pool);
+        std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+        std::cout << threads << " threads: " << duration.count() << " seconds, " << query_count / duration.count() / 1e6 << " million queries per second" << std::endl;
+    }
+
+    // Spot-check a few sources against a full minimax search
+    int mismatches = 0;
+    for (int q = 0; q < std::min(query_count, 3); ++q) {
+        std::vector<double> expected = minimax_search(edges, vertex_count, queries[q].first);
+        for (int i = 0; i < query_count; ++i) {
+            if (queries[i].first == queries[q].first) {
+                mismatches += expected[queries[i].second] != results[i];
+            }
+        }
+        mismatches += expected[queries[q].second] != bottleneck_distance(index, queries[q].first, queries[q].second);
+    }
+    std::cout << "Mismatches against a minimax search: " << mismatches << std::endl;
+
+    return 0;
+}
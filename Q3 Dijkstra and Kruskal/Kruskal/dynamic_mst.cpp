@@ -0,0 +1,85 @@
+// Build: g++ -O2 -std=c++17 -I../../common dynamic_mst.cpp -o dynamic_mst.exe
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+#include "kruskal.h"
+#include "dynamic_mst.h"
+
+// Function to add up the distances of a list of routes
+double sum_distances(const std::vector<KruskalEdge> &edges)
+{
+    double total = 0;
+    for (const auto &edge : edges) {
+        total += edge.distance;
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: dynamic_mst [vertex_count edge_count update_count] -- without arguments the star dataset is edited
+    int vertex_count = 0;
+    std::vector<KruskalEdge> edges;
+    if (argc >= 4) {
+        vertex_count = std::atoi(argv[1]);
+        edges = generate_random_edges(vertex_count, std::atoi(argv[2]), 42);
+    } else {
+        StarIdTable ids;
+        edges = read_kruskal_dataset("dataset2_1.txt", ids);
+        vertex_count = ids.size();
+    }
+    int update_count = argc >= 4 ? std::atoi(argv[3]) : 1000;
+
+    auto start_time = std::chrono::steady_clock::now();
+    DynamicMst dynamic(edges, vertex_count);
+    double build_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    // Apply a random mix of route insertions, removals and reweights, checking against kruskal() now and then
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> pick(0, vertex_count - 1);
+    std::uniform_real_distribution<double> length(1.0, 1000.0);
+    double update_seconds[3] = {0, 0, 0};
+    int updates[3] = {0, 0, 0};
+    long long total_work = 0;
+    int mismatches = 0, checks = 0;
+    double rerun_seconds = 0;
+    for (int i = 0; i < update_count; ++i) {
+        int kind = i % 3;
+        int id = static_cast<int>(rng() % dynamic.routes.size());
+        auto start_update = std::chrono::steady_clock::now();
+        if (kind == 0) {
+            dynamic.insert_route(pick(rng), pick(rng), length(rng));
+        } else if (kind == 1) {
+            dynamic.remove_route(id);
+        } else {
+            dynamic.set_route_distance(id, dynamic.routes[id].distance * std::uniform_real_distribution<double>(0.5, 2.0)(rng));
+        }
+        update_seconds[kind] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_update).count();
+        ++updates[kind];
+        total_work += dynamic.last_update_work;
+
+        if (i % std::max(1, update_count / 20) == 0 || i == update_count - 1) {
+            auto start_rerun = std::chrono::steady_clock::now();
+            double expected = sum_distances(kruskal(dynamic.live_routes(), vertex_count));
+            rerun_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_rerun).count();
+            ++checks;
+            if (std::abs(expected - dynamic.total_distance) > 1e-6 * std::max(1.0, expected)) {
+                ++mismatches;
+            }
+        }
+    }
+
+    std::cout << "Stars: " << vertex_count << ", routes: " << edges.size() << ", updates: " << update_count << std::endl;
+    std::cout << "Initial build: " << build_seconds * 1e3 << " milliseconds, full kruskal() rerun: " << rerun_seconds * 1e6 << " microseconds" << std::endl;
+    const char *labels[3] = {"insert", "remove", "reweight"};
+    for (int kind = 0; kind < 3; ++kind) {
+        std::cout << "Average " << labels[kind] << ": " << update_seconds[kind] / std::max(1, updates[kind]) * 1e6 << " microseconds" << std::endl;
+    }
+    std::cout << "Average stars and routes touched per update: " << static_cast<double>(total_work) / update_count << std::endl;
+    std::cout << "Tree routes: " << dynamic.tree_size << ", total distance: " << dynamic.total_distance << std::endl;
+    std::cout << "Mismatches against a full rerun: " << mismatches << " of " << checks << " checks" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,410 @@
+#ifndef DYNAMIC_MINIMUM_SPANNING_TREE_H
+#define DYNAMIC_MINIMUM_SPANNING_TREE_H
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "kruskal.h"
+
+// Define LinkCutForest struct: link-cut trees (Sleator and Tarjan) answering path-maximum queries
+// Nodes 0..vertex_count-1 are stars; every tree route gets its own node carrying its distance, so the
+// heaviest node on a path is the heaviest route on it. Every operation is O(log n) amortized.
+struct LinkCutForest {
+    std::vector<int> left, right, parent; // splay children and parent (or path-parent), -1 for none
+    std::vector<bool> flipped;            // pending reversal of the splay subtree
+    std::vector<double> value;
+    std::vector<int> heaviest;            // heaviest node in the splay subtree, ties broken by lower node
+
+    // Function to add a node with the given value, returns its id
+    int add_node(double node_value) {
+        left.push_back(-1);
+        right.push_back(-1);
+        parent.push_back(-1);
+        flipped.push_back(false);
+        value.push_back(node_value);
+        heaviest.push_back(static_cast<int>(value.size()) - 1);
+        return static_cast<int>(value.size()) - 1;
+    }
+
+    // Function to change a node's value; the node must be isolated or the root of its splay tree
+    void set_value(int x, double node_value) {
+        access(x);
+        value[x] = node_value;
+        update(x);
+    }
+
+    // Function to tell whether two stars are in the same tree
+    bool connected(int u, int v) {
+        return u == v || find_root(u) == find_root(v);
+    }
+
+    // Function to join the trees of u and v with an edge; they must not be connected
+    void link(int u, int v) {
+        make_root(u);
+        parent[u] = v;
+    }
+
+    // Function to remove the edge between adjacent nodes u and v
+    void cut(int u, int v) {
+        make_root(u);
+        access(v);
+        // u is now v's left child with nothing else on the path
+        left[v] = -1;
+        parent[u] = -1;
+        update(v);
+    }
+
+    // Function to find the heaviest node on the path between u and v; they must be connected
+    int path_heaviest(int u, int v) {
+        make_root(u);
+        access(v);
+        return heaviest[v];
+    }
+
+private:
+    bool is_splay_root(int x) const {
+        int p = parent[x];
+        return p < 0 || (left[p] != x && right[p] != x);
+    }
+
+    int heavier(int a, int b) const {
+        if (a < 0) {
+            return b;
+        }
+        if (b < 0) {
+            return a;
+        }
+        if (value[a] != value[b]) {
+            return value[a] > value[b] ? a : b;
+        }
+        return std::min(a, b);
+    }
+
+    void update(int x) {
+        heaviest[x] = heavier(x, heavier(left[x] >= 0 ? heaviest[left[x]] : -1, right[x] >= 0 ? heaviest[right[x]] : -1));
+    }
+
+    void push_down(int x) {
+        if (flipped[x]) {
+            std::swap(left[x], right[x]);
+            if (left[x] >= 0) {
+                flipped[left[x]] = !flipped[left[x]];
+            }
+            if (right[x] >= 0) {
+                flipped[right[x]] = !flipped[right[x]];
+            }
+            flipped[x] = false;
+        }
+    }
+
+    void rotate(int x) {
+        int p = parent[x], g = parent[p];
+        bool p_was_root = is_splay_root(p);
+        if (left[p] == x) {
+            left[p] = right[x];
+            if (right[x] >= 0) {
+                parent[right[x]] = p;
+            }
+            right[x] = p;
+        } else {
+            right[p] = left[x];
+            if (left[x] >= 0) {
+                parent[left[x]] = p;
+            }
+            left[x] = p;
+        }
+        parent[p] = x;
+        parent[x] = g;
+        if (!p_was_root) {
+            (left[g] == p ? left[g] : right[g]) = x;
+        }
+        update(p);
+        update(x);
+    }
+
+    void splay(int x) {
+        // Apply pending reversals from the splay root down before rotating
+        std::vector<int> &path = splay_path;
+        path.clear();
+        for (int y = x;; y = parent[y]) {
+            path.push_back(y);
+            if (is_splay_root(y)) {
+                break;
+            }
+        }
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            push_down(*it);
+        }
+        while (!is_splay_root(x)) {
+            int p = parent[x];
+            if (!is_splay_root(p)) {
+                int g = parent[p];
+                rotate((left[g] == p) == (left[p] == x) ? p : x);
+            }
+            rotate(x);
+        }
+    }
+
+    void access(int x) {
+        int last = -1;
+        for (int y = x; y >= 0; y = parent[y]) {
+            splay(y);
+            right[y] = last;
+            update(y);
+            last = y;
+        }
+        splay(x);
+    }
+
+    void make_root(int x) {
+        access(x);
+        flipped[x] = !flipped[x];
+    }
+
+    int find_root(int x) {
+        access(x);
+        while (true) {
+            push_down(x);
+            if (left[x] < 0) {
+                break;
+            }
+            x = left[x];
+        }
+        splay(x);
+        return x;
+    }
+
+    std::vector<int> splay_path;
+};
+
+// Define DynamicMst struct
+// Keeps a minimum spanning forest while routes are added, removed or reweighted.
+// Insertions and distance decreases are O(log n) amortized: the new route replaces the heaviest route on the
+// cycle it closes. Removing (or lengthening) a tree route splits a tree in two; both halves are walked in
+// step until the smaller one is fully known, and the lightest non-tree route leaving it is the replacement.
+// That costs O(routes touching the smaller half), which is small for the usual leaf-ward cut but not
+// polylogarithmic: a cut through the middle of a tree costs O(n + m).
+struct DynamicMst {
+    int vertex_count;
+    std::vector<KruskalEdge> routes;         // indexed by route id
+    std::vector<bool> alive, in_tree;
+    std::vector<std::vector<int>> incident;  // route ids per star; removed ids are dropped lazily
+    double total_distance = 0;
+    int tree_size = 0;
+    long long last_update_work = 0;          // stars and routes touched by the most recent edit
+    LinkCutForest forest;
+
+    DynamicMst(const std::vector<KruskalEdge> &initial_routes, int star_count) : vertex_count(star_count), incident(star_count), mark(star_count, 0) {
+        for (int v = 0; v < vertex_count; ++v) {
+            forest.add_node(-std::numeric_limits<double>::infinity());
+        }
+        for (const auto &route : initial_routes) {
+            add_route_record(route);
+        }
+        // Start from a static MST so the initial build is one sort rather than m cycle queries
+        std::vector<int> order(routes.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<int>(i);
+        }
+        std::sort(order.begin(), order.end(), [this](int a, int b) { return lighter(a, b); });
+        DisjointSet uf(vertex_count);
+        for (int id : order) {
+            if (uf.unite(routes[id].from, routes[id].to)) {
+                attach(id);
+            }
+        }
+    }
+
+    // Function to add a new two-way route, returns its id
+    int insert_route(int u, int v, double route_distance) {
+        last_update_work = 0;
+        int id = add_route_record({u, v, route_distance});
+        place_route(id);
+        return id;
+    }
+
+    // Function to remove a route by id, returns false if it was already removed
+    bool remove_route(int id) {
+        last_update_work = 0;
+        if (id < 0 || id >= static_cast<int>(routes.size()) || !alive[id]) {
+            return false;
+        }
+        alive[id] = false;
+        if (in_tree[id]) {
+            detach(id);
+            reconnect(routes[id].from, routes[id].to);
+        }
+        return true;
+    }
+
+    // Function to change the distance of a route, returns false if it was removed
+    bool set_route_distance(int id, double route_distance) {
+        last_update_work = 0;
+        if (id < 0 || id >= static_cast<int>(routes.size()) || !alive[id]) {
+            return false;
+        }
+        double old_distance = routes[id].distance;
+        if (in_tree[id]) {
+            total_distance += route_distance - old_distance;
+            routes[id].distance = route_distance;
+            forest.set_value(vertex_count + id, route_distance);
+            if (route_distance > old_distance) {
+                // A longer tree route may lose to another route across the same cut; it stays a candidate itself
+                detach(id);
+                reconnect(routes[id].from, routes[id].to);
+            }
+        } else {
+            routes[id].distance = route_distance;
+            if (route_distance < old_distance) {
+                place_route(id);
+            }
+        }
+        return true;
+    }
+
+    // Function to list the current tree routes
+    std::vector<KruskalEdge> tree_routes() const {
+        std::vector<KruskalEdge> tree;
+        for (size_t id = 0; id < routes.size(); ++id) {
+            if (alive[id] && in_tree[id]) {
+                tree.push_back(routes[id]);
+            }
+        }
+        return tree;
+    }
+
+    // Function to list every live route
+    std::vector<KruskalEdge> live_routes() const {
+        std::vector<KruskalEdge> live;
+        for (size_t id = 0; id < routes.size(); ++id) {
+            if (alive[id]) {
+                live.push_back(routes[id]);
+            }
+        }
+        return live;
+    }
+
+private:
+    std::vector<long long> mark;  // side of the cut per star, valid for the current epoch only
+    long long epoch = 0;
+    std::vector<int> side[2];
+
+    int add_route_record(const KruskalEdge &route) {
+        int id = static_cast<int>(routes.size());
+        routes.push_back(route);
+        alive.push_back(true);
+        in_tree.push_back(false);
+        forest.add_node(route.distance); // node vertex_count + id
+        incident[route.from].push_back(id);
+        if (route.to != route.from) {
+            incident[route.to].push_back(id);
+        }
+        return id;
+    }
+
+    bool lighter(int a, int b) const {
+        return routes[a].distance != routes[b].distance ? routes[a].distance < routes[b].distance : a < b;
+    }
+
+    void attach(int id) {
+        int node = vertex_count + id;
+        forest.set_value(node, routes[id].distance);
+        forest.link(routes[id].from, node);
+        forest.link(node, routes[id].to);
+        in_tree[id] = true;
+        total_distance += routes[id].distance;
+        ++tree_size;
+    }
+
+    void detach(int id) {
+        int node = vertex_count + id;
+        forest.cut(routes[id].from, node);
+        forest.cut(node, routes[id].to);
+        in_tree[id] = false;
+        total_distance -= routes[id].distance;
+        --tree_size;
+    }
+
+    // Function to add a non-tree route to the forest if it beats the heaviest route on the cycle it closes
+    void place_route(int id) {
+        const KruskalEdge &route = routes[id];
+        if (route.from == route.to) {
+            return;
+        }
+        if (!forest.connected(route.from, route.to)) {
+            attach(id);
+            return;
+        }
+        int heaviest = forest.path_heaviest(route.from, route.to) - vertex_count;
+        if (heaviest >= 0 && lighter(id, heaviest)) {
+            detach(heaviest);
+            attach(id);
+        }
+    }
+
+    // Function to expand one star of a half-tree walk, returns false once that half has been fully walked
+    bool walk_step(int s, size_t &head) {
+        if (head == side[s].size()) {
+            return false;
+        }
+        int star = side[s][head++];
+        std::vector<int> &list = incident[star];
+        size_t kept = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            int id = list[i];
+            if (!alive[id]) {
+                continue; // drop removed routes while passing
+            }
+            list[kept++] = id;
+            ++last_update_work;
+            if (in_tree[id]) {
+                int next = routes[id].from == star ? routes[id].to : routes[id].from;
+                if (mark[next] != 2 * epoch + s) {
+                    mark[next] = 2 * epoch + s;
+                    side[s].push_back(next);
+                }
+            }
+        }
+        list.resize(kept);
+        return true;
+    }
+
+    // Function to find the lightest route joining the two halves left by cutting the tree between a and b, and add it
+    void reconnect(int a, int b) {
+        ++epoch;
+        size_t head[2] = {0, 0};
+        side[0].assign(1, a);
+        side[1].assign(1, b);
+        mark[a] = 2 * epoch;
+        mark[b] = 2 * epoch + 1;
+        int small = -1;
+        while (small < 0) {
+            if (!walk_step(0, head[0])) {
+                small = 0;
+            } else if (!walk_step(1, head[1])) {
+                small = 1;
+            }
+        }
+
+        // Any live non-tree route from the finished half to a star outside it crosses the cut
+        int best = -1;
+        for (int star : side[small]) {
+            for (int id : incident[star]) {
+                if (!alive[id] || in_tree[id]) {
+                    continue;
+                }
+                ++last_update_work;
+                int other = routes[id].from == star ? routes[id].to : routes[id].from;
+                if (mark[other] != 2 * epoch + small && (best < 0 || lighter(id, best))) {
+                    best = id;
+                }
+            }
+        }
+        if (best >= 0) {
+            attach(best);
+        }
+    }
+};
+
+#endif // DYNAMIC_MINIMUM_SPANNING_TREE_H
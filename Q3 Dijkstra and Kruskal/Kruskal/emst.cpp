@@ -0,0 +1,65 @@
+// Build: g++ -O2 -std=c++17 -I../../common emst.cpp -o emst.exe
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+#include "kruskal.h"
+#include "euclidean_mst.h"
+
+// Function to build the Euclidean MST by listing every pair, only used to check small inputs
+std::vector<KruskalEdge> all_pairs_mst(const std::vector<Star> &stars)
+{
+    std::vector<KruskalEdge> pairs;
+    for (int i = 0; i < static_cast<int>(stars.size()); ++i) {
+        for (int j = i + 1; j < static_cast<int>(stars.size()); ++j) {
+            pairs.push_back({i, j, calculate_distance(stars[i].x, stars[i].y, stars[i].z, stars[j].x, stars[j].y, stars[j].z)});
+        }
+    }
+    return kruskal(pairs, static_cast<int>(stars.size()));
+}
+
+// Function to add up the distances of a spanning tree
+double mst_weight(const std::vector<KruskalEdge> &mst)
+{
+    double total = 0;
+    for (const auto &edge : mst) {
+        total += edge.distance;
+    }
+    return total;
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: emst [star_count] -- without arguments the stars of dataset2_1.txt are used
+    std::vector<Star> stars;
+    if (argc >= 2) {
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+        stars.resize(std::atoi(argv[1]));
+        for (size_t i = 0; i < stars.size(); ++i) {
+            stars[i] = {generated_star_name(static_cast<int>(i)), coordinate(rng), coordinate(rng), coordinate(rng), 0, 0};
+        }
+    } else {
+        stars = read_kruskal_stars("dataset2_1.txt");
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<KruskalEdge> mst = euclidean_mst(stars);
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+
+    StarIdTable ids;
+    for (const auto &star : stars) {
+        ids.intern(star.name);
+    }
+    save_mst(mst, ids, argc >= 2 ? "euclidean_mst_random.txt" : "euclidean_mst.txt");
+    std::cout << "Stars: " << stars.size() << ", tree edges: " << mst.size() << ", total distance: " << mst_weight(mst) << std::endl;
+    std::cout << "Execution time: " << duration.count() << " seconds" << std::endl;
+
+    // Cross-check against the all-pairs tree while that is still affordable
+    if (stars.size() <= 3000) {
+        std::cout << "All-pairs Kruskal total distance: " << mst_weight(all_pairs_mst(stars)) << std::endl;
+    }
+
+    return 0;
+}
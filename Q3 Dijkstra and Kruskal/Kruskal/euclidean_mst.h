@@ -0,0 +1,251 @@
+#ifndef EUCLIDEAN_MINIMUM_SPANNING_TREE_H
+#define EUCLIDEAN_MINIMUM_SPANNING_TREE_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <limits>
+#include <algorithm>
+#include <unordered_set>
+#include "q1_dataset2.h"
+#include "kruskal.h"
+
+// Function to read the stars (not the routes) of a dataset
+std::vector<Star> read_kruskal_stars(const std::string &filename) {
+    std::ifstream infile(filename);
+    std::vector<Star> stars;
+
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return stars;
+    }
+
+    std::unordered_set<std::string> seen;
+    std::string line;
+    while (std::getline(infile, line)) {
+        Star star;
+        if (parse_star_line(line, star.name, star.x, star.y, star.z, star.weight, star.profit) && seen.insert(star.name).second) {
+            stars.push_back(star);
+        }
+    }
+
+    infile.close();
+    return stars;
+}
+
+// Define KdNode struct: a box of points [begin, end) in the k-d tree's point order
+struct KdNode {
+    double low[3], high[3];
+    int begin, end;
+    int left, right;   // child nodes, -1 for a leaf
+    int component;     // component shared by every point below, -1 if mixed
+};
+
+// Define KdTree struct: array-based k-d tree over star coordinates
+struct KdTree {
+    std::vector<double> coordinates; // x, y, z per point, in tree order
+    std::vector<int> point_index;    // tree order -> original star index
+    std::vector<KdNode> nodes;
+};
+
+// Function to build the tree node for points [begin, end), splitting on the widest dimension at the median
+int build_kd_node(KdTree &tree, const std::vector<Star> &stars, int begin, int end) {
+    const int leaf_size = 8;
+    KdNode node;
+    node.begin = begin;
+    node.end = end;
+    node.left = node.right = -1;
+    node.component = -1;
+    for (int d = 0; d < 3; ++d) {
+        node.low[d] = std::numeric_limits<double>::infinity();
+        node.high[d] = -std::numeric_limits<double>::infinity();
+    }
+    for (int i = begin; i < end; ++i) {
+        const Star &star = stars[tree.point_index[i]];
+        double point[3] = {star.x, star.y, star.z};
+        for (int d = 0; d < 3; ++d) {
+            node.low[d] = std::min(node.low[d], point[d]);
+            node.high[d] = std::max(node.high[d], point[d]);
+        }
+    }
+
+    int id = static_cast<int>(tree.nodes.size());
+    tree.nodes.push_back(node);
+    if (end - begin <= leaf_size) {
+        return id;
+    }
+
+    int split = 0;
+    for (int d = 1; d < 3; ++d) {
+        if (node.high[d] - node.low[d] > node.high[split] - node.low[split]) {
+            split = d;
+        }
+    }
+    auto coordinate = [&stars, split](int index) {
+        return split == 0 ? stars[index].x : split == 1 ? stars[index].y : stars[index].z;
+    };
+    int middle = begin + (end - begin) / 2;
+    std::nth_element(tree.point_index.begin() + begin, tree.point_index.begin() + middle, tree.point_index.begin() + end,
+                     [&coordinate](int a, int b) { return coordinate(a) < coordinate(b); });
+
+    int left = build_kd_node(tree, stars, begin, middle);
+    int right = build_kd_node(tree, stars, middle, end);
+    tree.nodes[id].left = left;
+    tree.nodes[id].right = right;
+    return id;
+}
+
+// Function to build a k-d tree over the stars
+KdTree build_kd_tree(const std::vector<Star> &stars) {
+    KdTree tree;
+    tree.point_index.resize(stars.size());
+    for (size_t i = 0; i < stars.size(); ++i) {
+        tree.point_index[i] = static_cast<int>(i);
+    }
+    if (!stars.empty()) {
+        build_kd_node(tree, stars, 0, static_cast<int>(stars.size()));
+    }
+    tree.coordinates.resize(3 * stars.size());
+    for (size_t i = 0; i < stars.size(); ++i) {
+        const Star &star = stars[tree.point_index[i]];
+        tree.coordinates[3 * i] = star.x;
+        tree.coordinates[3 * i + 1] = star.y;
+        tree.coordinates[3 * i + 2] = star.z;
+    }
+    return tree;
+}
+
+// Define EmstCandidate struct: the best edge found so far, ordered by (squared distance, smaller end, larger end)
+struct EmstCandidate {
+    double squared = std::numeric_limits<double>::infinity();
+    int from = -1, to = -1;
+
+    bool better_than(const EmstCandidate &other) const {
+        if (squared != other.squared) {
+            return squared < other.squared;
+        }
+        int a = std::min(from, to), b = std::max(from, to), c = std::min(other.from, other.to), d = std::max(other.from, other.to);
+        return a != c ? a < c : b < d;
+    }
+};
+
+// Function to search the tree for the nearest point outside the query point's component
+// Whole boxes are skipped when they hold only the query's component or lie farther than the best found
+void nearest_outside_component(const KdTree &tree, int node_id, int query, const std::vector<int> &component, EmstCandidate &best) {
+    const KdNode &node = tree.nodes[node_id];
+    if (node.component == component[query]) {
+        return;
+    }
+    const double *point = &tree.coordinates[3 * query];
+    double box_squared = 0;
+    for (int d = 0; d < 3; ++d) {
+        double gap = std::max(0.0, std::max(node.low[d] - point[d], point[d] - node.high[d]));
+        box_squared += gap * gap;
+    }
+    if (box_squared > best.squared) {
+        return;
+    }
+
+    if (node.left < 0) {
+        for (int i = node.begin; i < node.end; ++i) {
+            if (component[i] == component[query]) {
+                continue;
+            }
+            const double *other = &tree.coordinates[3 * i];
+            double dx = other[0] - point[0], dy = other[1] - point[1], dz = other[2] - point[2];
+            EmstCandidate candidate;
+            candidate.squared = dx * dx + dy * dy + dz * dz;
+            candidate.from = query;
+            candidate.to = i;
+            if (candidate.better_than(best)) {
+                best = candidate;
+            }
+        }
+        return;
+    }
+
+    // Visit the nearer child first so the bound tightens early
+    const KdNode &left = tree.nodes[node.left];
+    double left_gap = 0;
+    for (int d = 0; d < 3; ++d) {
+        double gap = std::max(0.0, std::max(left.low[d] - point[d], point[d] - left.high[d]));
+        left_gap += gap * gap;
+    }
+    const KdNode &right = tree.nodes[node.right];
+    double right_gap = 0;
+    for (int d = 0; d < 3; ++d) {
+        double gap = std::max(0.0, std::max(right.low[d] - point[d], point[d] - right.high[d]));
+        right_gap += gap * gap;
+    }
+    if (left_gap <= right_gap) {
+        nearest_outside_component(tree, node.left, query, component, best);
+        nearest_outside_component(tree, node.right, query, component, best);
+    } else {
+        nearest_outside_component(tree, node.right, query, component, best);
+        nearest_outside_component(tree, node.left, query, component, best);
+    }
+}
+
+// Function to compute the Euclidean minimum spanning tree of the star coordinates without listing all pairs
+// Edge endpoints are positions in stars
+// Boruvka rounds over a k-d tree: every star finds its nearest star in another component, each component keeps
+// its shortest such edge, and those edges are merged; the component count at least halves per round, so the
+// whole run is O(log n) rounds of near O(n log n) nearest-neighbour searches
+std::vector<KruskalEdge> euclidean_mst(const std::vector<Star> &stars) {
+    std::vector<KruskalEdge> mst;
+    int n = static_cast<int>(stars.size());
+    if (n < 2) {
+        return mst;
+    }
+
+    KdTree tree = build_kd_tree(stars);
+    DisjointSet uf(n); // over tree order
+    std::vector<int> component(n);
+    int components = n;
+
+    while (components > 1) {
+        for (int i = 0; i < n; ++i) {
+            component[i] = uf.find(i);
+        }
+        // Children come after their parent in the node array, so a reverse pass is bottom-up
+        for (int id = static_cast<int>(tree.nodes.size()) - 1; id >= 0; --id) {
+            KdNode &node = tree.nodes[id];
+            if (node.left < 0) {
+                node.component = component[node.begin];
+                for (int i = node.begin + 1; i < node.end && node.component >= 0; ++i) {
+                    if (component[i] != node.component) {
+                        node.component = -1;
+                    }
+                }
+            } else {
+                int left = tree.nodes[node.left].component;
+                node.component = left >= 0 && left == tree.nodes[node.right].component ? left : -1;
+            }
+        }
+
+        // A star's search starts from its component's best so far, which prunes most of the tree
+        std::vector<EmstCandidate> component_best(n);
+        for (int i = 0; i < n; ++i) {
+            EmstCandidate best = component_best[component[i]];
+            nearest_outside_component(tree, 0, i, component, best);
+            if (best.better_than(component_best[component[i]])) {
+                component_best[component[i]] = best;
+            }
+        }
+
+        for (int root = 0; root < n; ++root) {
+            const EmstCandidate &best = component_best[root];
+            if (best.from >= 0 && uf.unite(best.from, best.to)) {
+                int a = tree.point_index[best.from], b = tree.point_index[best.to];
+                mst.push_back({a, b, calculate_distance(stars[a].x, stars[a].y, stars[a].z, stars[b].x, stars[b].y, stars[b].z)});
+                --components;
+            }
+        }
+    }
+
+    return mst;
+}
+
+#endif // EUCLIDEAN_MINIMUM_SPANNING_TREE_H
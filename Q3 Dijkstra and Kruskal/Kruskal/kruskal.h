@@ -6,15 +6,45 @@
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
+#include <random>
 #include "q1_dataset2.h"
+#include "graph_snapshot.h"
 
+// Define KruskalEdge struct: a route between two star ids (see StarIdTable for the names)
 struct KruskalEdge {
-    char from;
-    char to;
+    int32_t from;
+    int32_t to;
     double distance;
 };
 
-// Union-Find data structure
+// Function to generate random routes between vertex_count stars for benchmarking
+// A random spanning path is included so the graph is connected
+std::vector<KruskalEdge> generate_random_edges(int vertex_count, int edge_count, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, vertex_count - 1);
+    std::uniform_real_distribution<double> length(1.0, 1000.0);
+    std::vector<int> order(vertex_count);
+    for (int i = 0; i < vertex_count; ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<KruskalEdge> edges;
+    edges.reserve(edge_count);
+    for (int i = 1; i < vertex_count && static_cast<int>(edges.size()) < edge_count; ++i) {
+        edges.push_back({order[i - 1], order[i], length(rng)});
+    }
+    while (static_cast<int>(edges.size()) < edge_count) {
+        int from = pick(rng), to = pick(rng);
+        if (from != to) {
+            edges.push_back({from, to, length(rng)});
+        }
+    }
+    std::shuffle(edges.begin(), edges.end(), rng);
+    return edges;
+}
+
+// Union-Find data structure (recursive find with separate rank storage, kept as the baseline in union_find_bench.cpp)
 struct UnionFind {
     std::vector<int> parent, rank;
 
@@ -49,8 +79,63 @@ struct UnionFind {
     }
 };
 
+// Disjoint-set forest packed into one array: a root stores -(size of its set), any other star stores its parent
+// find() is iterative with path halving, so no recursion depth builds up on long chains
+struct DisjointSet {
+    std::vector<int> parent_or_size;
+
+    DisjointSet(int n) : parent_or_size(n, -1) {}
+
+    int find(int u) {
+        while (parent_or_size[u] >= 0) {
+            int parent = parent_or_size[u];
+            if (parent_or_size[parent] >= 0) {
+                parent_or_size[u] = parent_or_size[parent]; // Path halving: skip to the grandparent
+            }
+            u = parent_or_size[u];
+        }
+        return u;
+    }
+
+    // Merge the sets of u and v (smaller under larger), returns false if they were already one set
+    bool unite(int u, int v) {
+        int root_u = find(u);
+        int root_v = find(v);
+        if (root_u == root_v) {
+            return false;
+        }
+        if (parent_or_size[root_u] > parent_or_size[root_v]) {
+            std::swap(root_u, root_v); // root_u is now the larger set
+        }
+        parent_or_size[root_u] += parent_or_size[root_v];
+        parent_or_size[root_v] = root_u;
+        return true;
+    }
+
+    // Unite a block of pairs in order, setting merged[i] when pair i joined two sets; returns the merge count
+    // The entries for pairs a few steps ahead are prefetched to hide cache misses on large forests
+    int unite_batch(const int *from, const int *to, int count, unsigned char *merged) {
+        const int lookahead = 8;
+        int merges = 0;
+        for (int i = 0; i < count; ++i) {
+#if defined(__GNUC__)
+            if (i + lookahead < count) {
+                __builtin_prefetch(&parent_or_size[from[i + lookahead]]);
+                __builtin_prefetch(&parent_or_size[to[i + lookahead]]);
+            }
+#endif
+            merged[i] = unite(from[i], to[i]) ? 1 : 0;
+            merges += merged[i];
+        }
+        return merges;
+    }
+
+    int set_size(int u) { return -parent_or_size[find(u)]; }
+};
+
 // Function to read dataset for Kruskal's algorithm
-std::vector<KruskalEdge> read_kruskal_dataset(const std::string &filename) {
+// Stars get ids in the order they are declared; ids.size() is the vertex count. A route naming an undeclared star is skipped
+std::vector<KruskalEdge> read_kruskal_dataset(const std::string &filename, StarIdTable &ids) {
     std::ifstream infile(filename);
     std::vector<KruskalEdge> edges;
 
@@ -59,12 +144,17 @@ std::vector<KruskalEdge> read_kruskal_dataset(const std::string &filename) {
         return edges; // Return an empty vector if file cannot be opened
     }
 
-    std::string line;
+    std::string line, name, from, to;
     while (std::getline(infile, line)) {
-        char from, to;
-        double distance;
-        if (sscanf(line.c_str(), "Route %c-%c Distance: %lf", &from, &to, &distance) == 3) {
-            edges.push_back({from, to, distance});
+        double x, y, z, distance;
+        int weight, profit;
+        if (parse_star_line(line, name, x, y, z, weight, profit)) {
+            ids.intern(name);
+        } else if (parse_route_line(line, from, to, distance)) {
+            int32_t a = ids.find(from), b = ids.find(to);
+            if (a >= 0 && b >= 0) {
+                edges.push_back({a, b, distance});
+            }
         }
     }
 
@@ -72,6 +162,26 @@ std::vector<KruskalEdge> read_kruskal_dataset(const std::string &filename) {
     return edges;
 }
 
+// Function to read the route list for Kruskal's algorithm from a binary snapshot
+std::vector<KruskalEdge> read_kruskal_snapshot(const std::string &filename, StarIdTable &ids) {
+    std::vector<KruskalEdge> edges;
+    GraphSnapshot snapshot;
+    if (!open_graph_snapshot(filename, snapshot)) {
+        return edges; // Return an empty vector if file cannot be opened
+    }
+
+    for (uint64_t i = 0; i < snapshot.star_count; ++i) {
+        ids.intern(snapshot_star_name(snapshot, i));
+    }
+    edges.reserve(snapshot.route_count);
+    for (uint64_t r = 0; r < snapshot.route_count; ++r) {
+        edges.push_back({snapshot.route_from[r], snapshot.route_to[r], snapshot.route_distance[r]});
+    }
+
+    close_graph_snapshot(snapshot);
+    return edges;
+}
+
 // Define Kruskal's algorithm implementation
 std::vector<KruskalEdge> kruskal(const std::vector<KruskalEdge> &edges, int vertex_count) {
     std::vector<KruskalEdge> mst;
@@ -82,24 +192,67 @@ std::vector<KruskalEdge> kruskal(const std::vector<KruskalEdge> &edges, int vert
         return a.distance < b.distance;
     });
 
-    UnionFind uf(vertex_count);
-
-    auto get_index = [](char name) { return name - 'A'; }; // Convert star name to index
+    DisjointSet uf(vertex_count);
 
     for (const auto &edge : sorted_edges) {
-        int u = get_index(edge.from);
-        int v = get_index(edge.to);
-        if (uf.find(u) != uf.find(v)) {
-            uf.union_sets(u, v);
+        if (uf.unite(edge.from, edge.to)) {
             mst.push_back(edge);
-            if (mst.size() == vertex_count - 1) break; // Stop when MST has n-1 edges
+            if (static_cast<int>(mst.size()) == vertex_count - 1) break; // Stop when MST has n-1 edges
+        }
+    }
+
+    return mst;
+}
+
+// Function to run Kruskal's algorithm ordering edges lazily, one lightest block at a time
+// Like quicksort that always recurses into the lighter side first: a range is partitioned around a pivot, the heavier
+// part is set aside unsorted, and only blocks of at most 1024 edges are sorted and consumed. The loop stops at n-1
+// tree edges, so edges heavier than the last tree edge are only ever partitioned, never sorted; total work is
+// O(m + k log k) for the k edges consumed. (A binary heap extracts the same prefix but each pop misses cache
+// all the way down, which made it slower than the full sort on large graphs.)
+std::vector<KruskalEdge> kruskal_lazy(const std::vector<KruskalEdge> &edges, int vertex_count) {
+    const size_t block_size = 1024;
+    std::vector<KruskalEdge> mst;
+    std::vector<KruskalEdge> work = edges;
+    std::vector<std::pair<size_t, size_t>> pending; // unsorted ranges, the lightest on top
+    pending.push_back({0, work.size()});
+
+    DisjointSet uf(vertex_count);
+    while (!pending.empty() && static_cast<int>(mst.size()) < vertex_count - 1) {
+        size_t begin = pending.back().first, end = pending.back().second;
+        pending.pop_back();
+
+        while (end - begin > block_size) {
+            // Median of three as the pivot; split off everything at least as heavy
+            double a = work[begin].distance, b = work[begin + (end - begin) / 2].distance, c = work[end - 1].distance;
+            double pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+            auto middle = std::partition(work.begin() + begin, work.begin() + end, [pivot](const KruskalEdge &edge) { return edge.distance < pivot; });
+            if (middle == work.begin() + begin) {
+                // The pivot is the lightest distance: peel off its copies instead
+                middle = std::partition(work.begin() + begin, work.begin() + end, [pivot](const KruskalEdge &edge) { return edge.distance <= pivot; });
+                if (middle == work.begin() + end) {
+                    break; // every edge in the range has the same distance
+                }
+            }
+            size_t split = static_cast<size_t>(middle - work.begin());
+            pending.push_back({split, end});
+            end = split;
+        }
+
+        std::sort(work.begin() + begin, work.begin() + end, [](const KruskalEdge &x, const KruskalEdge &y) { return x.distance < y.distance; });
+        for (size_t i = begin; i < end; ++i) {
+            if (uf.unite(work[i].from, work[i].to)) {
+                mst.push_back(work[i]);
+                if (static_cast<int>(mst.size()) == vertex_count - 1) break; // Stop when MST has n-1 edges
+            }
         }
     }
 
     return mst;
 }
 
-void save_mst(const std::vector<KruskalEdge> &mst, const std::string &filename) {
+// Function to save the MST with star names
+void save_mst(const std::vector<KruskalEdge> &mst, const StarIdTable &ids, const std::string &filename) {
     std::ofstream outfile(filename);
     if (!outfile.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
@@ -107,7 +260,7 @@ void save_mst(const std::vector<KruskalEdge> &mst, const std::string &filename)
     }
 
     for (const auto &edge : mst) {
-        outfile << "Connected Stars: " << edge.from << " - " << edge.to << " Distance: " << edge.distance << std::endl;
+        outfile << "Connected Stars: " << ids.names[edge.from] << " - " << ids.names[edge.to] << " Distance: " << edge.distance << std::endl;
     }
 
     outfile.close();
@@ -0,0 +1,44 @@
+// Build: g++ -O2 -std=c++17 -I../../common kruskal_lazy_bench.cpp -o kruskal_lazy_bench.exe
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+#include "kruskal.h"
+
+// Function to time one Kruskal variant, returning seconds and the tree's total distance
+template <typename Variant>
+std::pair<double, double> time_variant(Variant variant)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<KruskalEdge> mst = variant();
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+    double total = 0;
+    for (const auto &edge : mst) {
+        total += edge.distance;
+    }
+    return {duration.count(), total};
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: kruskal_lazy_bench [vertex_count]
+    // Compares the full sort with lazy block-by-block ordering as the average degree grows
+    int vertex_count = argc >= 2 ? std::atoi(argv[1]) : 100000;
+    const int degrees[] = {2, 4, 8, 16, 32, 64, 128};
+
+    std::cout << "Vertices: " << vertex_count << std::endl;
+    std::cout << "avg_degree  edges  sorted(s)  lazy(s)  speedup" << std::endl;
+    for (int degree : degrees) {
+        long long edge_count = static_cast<long long>(vertex_count) * degree / 2;
+        std::vector<KruskalEdge> edges = generate_random_edges(vertex_count, static_cast<int>(edge_count), 42);
+
+        auto sorted_result = time_variant([&]() { return kruskal(edges, vertex_count); });
+        auto lazy_result = time_variant([&]() { return kruskal_lazy(edges, vertex_count); });
+        bool agree = std::abs(sorted_result.second - lazy_result.second) <= 1e-6 * sorted_result.second;
+
+        std::cout << degree << "  " << edge_count << "  " << sorted_result.first << "  " << lazy_result.first << "  "
+                  << sorted_result.first / lazy_result.first << "x" << (agree ? "" : "  <-- totals differ") << std::endl;
+    }
+
+    return 0;
+}
@@ -1,3 +1,4 @@
+// Build: g++ -O2 -std=c++17 -I../../common mst.cpp -o mst.exe
 #include <iostream>
 #include <chrono> // For timing
 
@@ -14,36 +15,39 @@ void generate_dataset2()
     std::vector<Star> stars = generate_stars(star_count, sum_of_ids);
 
     // Generate routes
-    std::vector<std::pair<char, char>> routes = generate_routes(star_count);
+    std::vector<std::pair<int, int>> routes = generate_routes(star_count);
 
     // Save dataset
     save_star_dataset(stars, routes, "dataset2_1.txt");
 }
 
-void find_minimum_spanning_tree()
+void find_minimum_spanning_tree(const std::string &dataset, bool lazy)
 {
-    // Read dataset
-    std::vector<KruskalEdge> edges = read_kruskal_dataset("dataset2_1.txt");
+    // Read dataset, a .snap file is read as a binary snapshot; the vertex count is the number of stars declared
+    StarIdTable ids;
+    std::vector<KruskalEdge> edges = is_snapshot_file(dataset) ? read_kruskal_snapshot(dataset, ids) : read_kruskal_dataset(dataset, ids);
 
-    // Find MST using Kruskal's algorithm
+    // Find MST using Kruskal's algorithm, "lazy" only sorts the edges it consumes
     auto start_time = std::chrono::high_resolution_clock::now(); // Start timing
-    std::vector<KruskalEdge> mst = kruskal(edges, 20);           // Assuming there are 20 stars
+    std::vector<KruskalEdge> mst = lazy ? kruskal_lazy(edges, ids.size()) : kruskal(edges, ids.size());
     auto end_time = std::chrono::high_resolution_clock::now();   // End timing
 
     // Calculate duration
     std::chrono::duration<double> duration = end_time - start_time;
 
     // Save MST
-    save_mst(mst, "minimum_spanning_tree.txt");
+    save_mst(mst, ids, "minimum_spanning_tree.txt");
 
     // Output execution time
     std::cout << "Execution time: " << duration.count() << " seconds" << std::endl;
 }
 
-int main()
+int main(int argc, char *argv[])
 {
 
-    find_minimum_spanning_tree(); // Call the function to find minimum spanning tree
+    // Usage: mst [dataset] [sort|lazy]
+    bool lazy = argc >= 3 && std::string(argv[2]) == "lazy";
+    find_minimum_spanning_tree(argc >= 2 ? argv[1] : "dataset2_1.txt", lazy); // Call the function to find minimum spanning tree
 
     return 0;
 }
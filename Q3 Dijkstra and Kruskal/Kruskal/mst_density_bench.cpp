@@ -0,0 +1,66 @@
+// Build: g++ -O2 -std=c++17 -I../../common mst_density_bench.cpp -o mst_density_bench.exe
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+#include "kruskal.h"
+#include "prim.h"
+
+// Function to time one MST algorithm, returning seconds and the tree's total distance
+template <typename Algorithm>
+std::pair<double, double> time_mst(Algorithm algorithm)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<KruskalEdge> mst = algorithm();
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+    double total = 0;
+    for (const auto &edge : mst) {
+        total += edge.distance;
+    }
+    return {duration.count(), total};
+}
+
+// Function to name an algorithm for the report
+const char *algorithm_name(MstAlgorithm algorithm)
+{
+    return algorithm == MstAlgorithm::PrimDense ? "Prim (array)" : algorithm == MstAlgorithm::PrimHeap ? "Prim (heap)" : "Kruskal";
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: mst_density_bench [vertex_count]
+    // Sweeps the route count from a sparse map up to every pair of stars and times each algorithm
+    StarIdTable ids;
+    std::vector<KruskalEdge> dataset = read_kruskal_dataset("dataset2_1.txt", ids);
+    if (!dataset.empty()) {
+        auto kruskal_result = time_mst([&]() { return kruskal(dataset, ids.size()); });
+        auto heap_result = time_mst([&]() { return prim_heap(dataset, ids.size()); });
+        auto dense_result = time_mst([&]() { return prim_dense(dataset, ids.size()); });
+        std::cout << "dataset2_1.txt: kruskal() " << kruskal_result.second << ", Prim (heap) " << heap_result.second
+                  << ", Prim (array) " << dense_result.second << ", dispatcher picks "
+                  << algorithm_name(choose_mst_algorithm(dataset.size(), ids.size())) << std::endl;
+    }
+
+    int vertex_count = argc >= 2 ? std::atoi(argv[1]) : 3000;
+    double pairs = 0.5 * vertex_count * (vertex_count - 1.0);
+    const double densities[] = {0.001, 0.003, 0.01, 0.03, 0.1, 0.3, 0.5, 0.7, 1.0};
+
+    std::cout << "Vertices: " << vertex_count << std::endl;
+    std::cout << "density  edges  kruskal(s)  prim_heap(s)  prim_dense(s)  dispatcher" << std::endl;
+    for (double density : densities) {
+        int edge_count = std::max(vertex_count - 1, static_cast<int>(density * pairs));
+        std::vector<KruskalEdge> edges = generate_random_edges(vertex_count, edge_count, 42);
+
+        auto kruskal_result = time_mst([&]() { return kruskal(edges, vertex_count); });
+        auto heap_result = time_mst([&]() { return prim_heap(edges, vertex_count); });
+        auto dense_result = time_mst([&]() { return prim_dense(edges, vertex_count); });
+        bool agree = std::abs(kruskal_result.second - heap_result.second) < 1e-6 * kruskal_result.second &&
+                     std::abs(kruskal_result.second - dense_result.second) < 1e-6 * kruskal_result.second;
+
+        std::cout << density << "  " << edge_count << "  " << kruskal_result.first << "  " << heap_result.first << "  "
+                  << dense_result.first << "  " << algorithm_name(choose_mst_algorithm(edges.size(), vertex_count))
+                  << (agree ? "" : "  <-- totals differ") << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,306 @@
+#ifndef PARALLEL_MINIMUM_SPANNING_TREE_H
+#define PARALLEL_MINIMUM_SPANNING_TREE_H
+
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <random>
+#include <cstdint>
+#include "kruskal.h"
+#include "thread_pool.h"
+
+// Function to order edges by distance, breaking ties by endpoints so every engine picks the same tree
+bool lighter_edge(const KruskalEdge &a, const KruskalEdge &b) {
+    if (a.distance != b.distance) {
+        return a.distance < b.distance;
+    }
+    return a.from != b.from ? a.from < b.from : a.to < b.to;
+}
+
+// Function to find a root without compressing the path, safe to call from several threads while nobody unites
+int find_root_readonly(const DisjointSet &uf, int u) {
+    while (uf.parent_or_size[u] >= 0) {
+        u = uf.parent_or_size[u];
+    }
+    return u;
+}
+
+// Function to split edges across the pool, keeping those that satisfy keep(edge), in their original order
+template <typename Keep>
+std::vector<KruskalEdge> parallel_select(const KruskalEdge *edges, int count, ThreadPool &pool, Keep keep) {
+    std::vector<std::vector<KruskalEdge>> kept(pool.size());
+    pool.parallel_for(count, [&](int begin, int end, int t) {
+        for (int i = begin; i < end; ++i) {
+            if (keep(edges[i])) {
+                kept[t].push_back(edges[i]);
+            }
+        }
+    });
+
+    std::vector<KruskalEdge> result;
+    size_t total = 0;
+    for (const auto &part : kept) {
+        total += part.size();
+    }
+    result.reserve(total);
+    for (const auto &part : kept) {
+        result.insert(result.end(), part.begin(), part.end());
+    }
+    return result;
+}
+
+// Function to run filter-Kruskal on a block of edges (Osipov, Sanders and Singler)
+// Edges are split around a sampled pivot; the light half is solved first, then heavy edges whose
+// endpoints are already connected are filtered out before the heavy half is sorted at all
+void filter_kruskal_block(std::vector<KruskalEdge> &edges, DisjointSet &uf, std::vector<KruskalEdge> &mst, int vertex_count, ThreadPool &pool, std::mt19937 &rng) {
+    const size_t base_case = 1 << 16;
+    std::vector<KruskalEdge> light, heavy;
+    if (edges.size() > base_case) {
+        // Median of a small random sample as the pivot
+        std::vector<KruskalEdge> sample;
+        std::uniform_int_distribution<size_t> pick(0, edges.size() - 1);
+        for (int i = 0; i < 63; ++i) {
+            sample.push_back(edges[pick(rng)]);
+        }
+        std::nth_element(sample.begin(), sample.begin() + 31, sample.end(), lighter_edge);
+        KruskalEdge pivot = sample[31];
+
+        light = parallel_select(edges.data(), static_cast<int>(edges.size()), pool, [&](const KruskalEdge &edge) { return !lighter_edge(pivot, edge); });
+        heavy = parallel_select(edges.data(), static_cast<int>(edges.size()), pool, [&](const KruskalEdge &edge) { return lighter_edge(pivot, edge); });
+    }
+
+    // Small blocks, and blocks the pivot failed to split (all duplicates), are sorted directly
+    if (edges.size() <= base_case || heavy.empty()) {
+        std::sort(edges.begin(), edges.end(), lighter_edge);
+        for (const auto &edge : edges) {
+            if (static_cast<int>(mst.size()) == vertex_count - 1) {
+                return;
+            }
+            if (uf.unite(edge.from, edge.to)) {
+                mst.push_back(edge);
+            }
+        }
+        return;
+    }
+
+    std::vector<KruskalEdge>().swap(edges);
+
+    filter_kruskal_block(light, uf, mst, vertex_count, pool, rng);
+    if (static_cast<int>(mst.size()) == vertex_count - 1) {
+        return;
+    }
+
+    heavy = parallel_select(heavy.data(), static_cast<int>(heavy.size()), pool, [&](const KruskalEdge &edge) {
+        return find_root_readonly(uf, edge.from) != find_root_readonly(uf, edge.to);
+    });
+    filter_kruskal_block(heavy, uf, mst, vertex_count, pool, rng);
+}
+
+// Function to compute a minimum spanning forest with filter-Kruskal, partitioning and filtering on the pool
+std::vector<KruskalEdge> filter_kruskal(const std::vector<KruskalEdge> &edges, int vertex_count, ThreadPool &pool) {
+    std::vector<KruskalEdge> mst;
+    std::vector<KruskalEdge> work = edges;
+    DisjointSet uf(vertex_count);
+    std::mt19937 rng(1);
+    filter_kruskal_block(work, uf, mst, vertex_count, pool, rng);
+    return mst;
+}
+
+// Define ConcurrentDisjointSet struct: lock-free union-find (Anderson and Woll style)
+// Roots point to themselves; unite links the root of lower priority under the other with a compare-and-swap,
+// and find halves paths with compare-and-swap so concurrent finds only ever shorten paths.
+// Priorities are a fixed hash of the index (ties broken by index), so the order is random but the same on
+// every run: linking by index would chain components 0 -> 1 -> 2 ... into trees as tall as the graph.
+struct ConcurrentDisjointSet {
+    std::vector<std::atomic<int>> parent;
+
+    ConcurrentDisjointSet(int n) : parent(n) {
+        for (int i = 0; i < n; ++i) {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Function to return the linking priority of an element (a 32-bit integer hash)
+    static uint32_t priority(int u) {
+        uint32_t x = static_cast<uint32_t>(u) * 0x9E3779B9u;
+        x ^= x >> 16;
+        x *= 0x85EBCA6Bu;
+        x ^= x >> 13;
+        return x;
+    }
+
+    int find(int u) {
+        while (true) {
+            int up = parent[u].load(std::memory_order_acquire);
+            if (up == u) {
+                return u;
+            }
+            int grand = parent[up].load(std::memory_order_acquire);
+            if (up != grand) {
+                parent[u].compare_exchange_weak(up, grand, std::memory_order_acq_rel);
+            }
+            u = grand;
+        }
+    }
+
+    bool unite(int u, int v) {
+        while (true) {
+            u = find(u);
+            v = find(v);
+            if (u == v) {
+                return false;
+            }
+            uint32_t priority_u = priority(u), priority_v = priority(v);
+            if (priority_u > priority_v || (priority_u == priority_v && u > v)) {
+                std::swap(u, v);
+            }
+            int expected = u;
+            if (parent[u].compare_exchange_strong(expected, v, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+    }
+};
+
+// Define BoruvkaEdge struct: an edge between two components of the current Boruvka round
+struct BoruvkaEdge {
+    int32_t from;
+    int32_t to;
+    int32_t index; // position in the input edge list
+    double distance;
+};
+
+// Function to compute a minimum spanning forest with parallel Boruvka
+// Each round every component picks its lightest outgoing edge (atomic min ordered by distance then input
+// position, so ties cannot form cycles) and the picked edges are united through the lock-free union-find.
+// The graph is then contracted: components are renumbered 0..k-1 and every surviving edge is rewritten
+// between component numbers, dropping those inside one component. Later rounds touch only the contracted
+// graph, with no finds per edge, and the number of components at least halves each round.
+// The first rounds still pass over every edge, so on a few cores this is usually slower than kruskal() or
+// filter_kruskal(); it is here for the many-core case, where each round splits evenly across threads.
+std::vector<KruskalEdge> parallel_boruvka(const std::vector<KruskalEdge> &edges, int vertex_count, ThreadPool &pool) {
+    const int64_t none = INT64_MAX;
+    const int thread_count = pool.size();
+    std::vector<std::vector<KruskalEdge>> picked(thread_count);
+    std::vector<std::vector<BoruvkaEdge>> survivors(thread_count);
+    std::vector<BoruvkaEdge> alive;
+
+    // Function to gather the per-thread survivors into alive, in thread order
+    auto gather = [&]() {
+        size_t total = 0;
+        for (const auto &part : survivors) {
+            total += part.size();
+        }
+        alive.clear();
+        alive.reserve(total);
+        for (auto &part : survivors) {
+            alive.insert(alive.end(), part.begin(), part.end());
+            part.clear();
+        }
+    };
+
+    pool.parallel_for(static_cast<int>(edges.size()), [&](int begin, int end, int t) {
+        for (int i = begin; i < end; ++i) {
+            if (edges[i].from != edges[i].to) {
+                survivors[t].push_back({edges[i].from, edges[i].to, i, edges[i].distance});
+            }
+        }
+    });
+    gather();
+
+    auto lighter = [&alive](int64_t a, int64_t b) {
+        return b == none || alive[a].distance < alive[b].distance || (alive[a].distance == alive[b].distance && alive[a].index < alive[b].index);
+    };
+    auto atomic_min = [&lighter](std::atomic<int64_t> &target, int64_t value) {
+        int64_t current = target.load(std::memory_order_relaxed);
+        while (lighter(value, current) && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    };
+
+    int components = vertex_count;
+    std::vector<std::atomic<int64_t>> best(vertex_count);
+    std::vector<int> label(vertex_count), root_number(vertex_count);
+    std::vector<int> root_counts(thread_count);
+    while (!alive.empty()) {
+        // Record the lightest edge leaving each component
+        pool.parallel_for(components, [&](int begin, int end, int) {
+            for (int c = begin; c < end; ++c) {
+                best[c].store(none, std::memory_order_relaxed);
+            }
+        });
+        pool.parallel_for(static_cast<int>(alive.size()), [&](int begin, int end, int) {
+            for (int i = begin; i < end; ++i) {
+                atomic_min(best[alive[i].from], i);
+                atomic_min(best[alive[i].to], i);
+            }
+        });
+
+        // Unite along the picked edges; an edge picked by both of its components is added once
+        ConcurrentDisjointSet uf(components);
+        pool.parallel_for(components, [&](int begin, int end, int t) {
+            for (int c = begin; c < end; ++c) {
+                int64_t e = best[c].load(std::memory_order_relaxed);
+                if (e != none && uf.unite(alive[e].from, alive[e].to)) {
+                    picked[t].push_back(edges[alive[e].index]);
+                }
+            }
+        });
+
+        // Number the new components: count the roots in each thread's block, then number them in block order
+        std::fill(root_counts.begin(), root_counts.end(), 0);
+        pool.parallel_for(components, [&](int begin, int end, int t) {
+            for (int c = begin; c < end; ++c) {
+                label[c] = uf.find(c);
+                root_counts[t] += label[c] == c;
+            }
+        });
+        int next_components = 0;
+        for (int t = 0; t < thread_count; ++t) {
+            int count = root_counts[t];
+            root_counts[t] = next_components;
+            next_components += count;
+        }
+        pool.parallel_for(components, [&](int begin, int end, int t) {
+            int next = root_counts[t];
+            for (int c = begin; c < end; ++c) {
+                if (label[c] == c) {
+                    root_number[c] = next++;
+                }
+            }
+        });
+        pool.parallel_for(components, [&](int begin, int end, int) {
+            for (int c = begin; c < end; ++c) {
+                label[c] = root_number[label[c]];
+            }
+        });
+
+        // Contract: rewrite each edge between new component numbers, dropping those inside one component
+        pool.parallel_for(static_cast<int>(alive.size()), [&](int begin, int end, int t) {
+            for (int i = begin; i < end; ++i) {
+                int from = label[alive[i].from], to = label[alive[i].to];
+                if (from != to) {
+                    survivors[t].push_back({from, to, alive[i].index, alive[i].distance});
+                }
+            }
+        });
+        gather();
+        components = next_components;
+    }
+
+    std::vector<KruskalEdge> mst;
+    for (const auto &part : picked) {
+        mst.insert(mst.end(), part.begin(), part.end());
+    }
+    return mst;
+}
+
+// Function to add up the distances of a spanning tree
+double total_distance(const std::vector<KruskalEdge> &mst) {
+    double total = 0;
+    for (const auto &edge : mst) {
+        total += edge.distance;
+    }
+    return total;
+}
+
+#endif // PARALLEL_MINIMUM_SPANNING_TREE_H
@@ -0,0 +1,59 @@
+// Build: g++ -O2 -std=c++17 -pthread -I../../common parallel_mst_bench.cpp -o parallel_mst_bench.exe
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+#include "kruskal.h"
+#include "parallel_mst.h"
+
+// Function to time one MST engine, returning its duration in seconds
+template <typename Engine>
+double time_engine(const std::string &label, double expected_weight, Engine engine)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::vector<KruskalEdge> mst = engine();
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+    double weight = total_distance(mst);
+    std::cout << label << ": " << duration.count() << " seconds, " << mst.size() << " edges, total distance " << weight
+              << (std::abs(weight - expected_weight) <= 1e-6 * expected_weight ? "" : "  <-- differs from kruskal()") << std::endl;
+    return duration.count();
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: parallel_mst_bench [vertex_count edge_count [max_threads]]
+    // The star dataset is checked first, then a generated graph is timed
+    // Boruvka passes over every remaining edge each round, so it only catches up with kruskal() given many cores
+    StarIdTable ids;
+    std::vector<KruskalEdge> dataset = read_kruskal_dataset("dataset2_1.txt", ids);
+    if (!dataset.empty()) {
+        ThreadPool pool(2);
+        double expected = total_distance(kruskal(dataset, ids.size()));
+        std::cout << "dataset2_1.txt: kruskal() " << expected << ", filter-Kruskal " << total_distance(filter_kruskal(dataset, ids.size(), pool))
+                  << ", Boruvka " << total_distance(parallel_boruvka(dataset, ids.size(), pool)) << std::endl;
+    }
+
+    int vertex_count = argc >= 3 ? std::atoi(argv[1]) : 1000000;
+    int edge_count = argc >= 3 ? std::atoi(argv[2]) : 10000000;
+    int max_threads = argc >= 4 ? std::atoi(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<KruskalEdge> edges = generate_random_edges(vertex_count, edge_count, 42);
+    std::cout << "Vertices: " << vertex_count << ", edges: " << edge_count << std::endl;
+
+    double expected = total_distance(kruskal(edges, vertex_count));
+    double sequential = time_engine("kruskal (sort + DisjointSet)", expected, [&]() { return kruskal(edges, vertex_count); });
+
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (int threads : thread_counts) {
+        ThreadPool pool(threads);
+        double filter = time_engine("filter-Kruskal, " + std::to_string(threads) + " threads", expected, [&]() { return filter_kruskal(edges, vertex_count, pool); });
+        double boruvka = time_engine("Boruvka, " + std::to_string(threads) + " threads", expected, [&]() { return parallel_boruvka(edges, vertex_count, pool); });
+        std::cout << "  time relative to kruskal (below 1 is faster): filter-Kruskal " << filter / sequential << ", Boruvka " << boruvka / sequential << std::endl;
+    }
+
+    return 0;
+}
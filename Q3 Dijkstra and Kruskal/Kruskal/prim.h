@@ -0,0 +1,151 @@
+#ifndef PRIM_MINIMUM_SPANNING_TREE_H
+#define PRIM_MINIMUM_SPANNING_TREE_H
+
+#include <vector>
+#include <queue>
+#include <limits>
+#include <functional>
+#include "kruskal.h"
+
+// Function to run the array-based O(V^2) Prim's algorithm on an adjacency matrix
+// No heap and no edge sort: each step scans the V candidate distances, which wins when routes approach V^2
+std::vector<KruskalEdge> prim_dense(const std::vector<KruskalEdge> &edges, int vertex_count) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<double> matrix(static_cast<size_t>(vertex_count) * vertex_count, infinity);
+    for (const auto &edge : edges) {
+        double &a = matrix[static_cast<size_t>(edge.from) * vertex_count + edge.to];
+        double &b = matrix[static_cast<size_t>(edge.to) * vertex_count + edge.from];
+        a = b = std::min(a, edge.distance); // Keep the shortest of parallel routes
+    }
+
+    std::vector<KruskalEdge> mst;
+    std::vector<double> key(vertex_count, infinity);
+    std::vector<int> link(vertex_count, -1);
+    std::vector<bool> in_tree(vertex_count, false);
+
+    for (int start = 0; start < vertex_count; ++start) {
+        if (in_tree[start]) {
+            continue;
+        }
+        // Grow one tree per component so disconnected inputs give a spanning forest
+        key[start] = 0;
+        while (true) {
+            int current = -1;
+            for (int v = 0; v < vertex_count; ++v) {
+                if (!in_tree[v] && key[v] != infinity && (current < 0 || key[v] < key[current])) {
+                    current = v;
+                }
+            }
+            if (current < 0) {
+                break;
+            }
+            in_tree[current] = true;
+            if (link[current] >= 0) {
+                mst.push_back({link[current], current, key[current]});
+            }
+            const double *row = &matrix[static_cast<size_t>(current) * vertex_count];
+            for (int v = 0; v < vertex_count; ++v) {
+                if (!in_tree[v] && row[v] < key[v]) {
+                    key[v] = row[v];
+                    link[v] = current;
+                }
+            }
+        }
+    }
+
+    return mst;
+}
+
+// Function to run heap-based Prim's algorithm over CSR adjacency lists, O(E log V)
+std::vector<KruskalEdge> prim_heap(const std::vector<KruskalEdge> &edges, int vertex_count) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    std::vector<int> offsets(vertex_count + 1, 0);
+    for (const auto &edge : edges) {
+        ++offsets[edge.from + 1];
+        ++offsets[edge.to + 1];
+    }
+    for (int v = 0; v < vertex_count; ++v) {
+        offsets[v + 1] += offsets[v];
+    }
+    std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+    std::vector<int> targets(offsets.back());
+    std::vector<double> distances(offsets.back());
+    for (const auto &edge : edges) {
+        targets[cursor[edge.from]] = edge.to;
+        distances[cursor[edge.from]++] = edge.distance;
+        targets[cursor[edge.to]] = edge.from;
+        distances[cursor[edge.to]++] = edge.distance;
+    }
+
+    std::vector<KruskalEdge> mst;
+    std::vector<double> key(vertex_count, infinity);
+    std::vector<int> link(vertex_count, -1);
+    std::vector<bool> in_tree(vertex_count, false);
+    std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<std::pair<double, int>>> pq;
+
+    for (int start = 0; start < vertex_count; ++start) {
+        if (in_tree[start]) {
+            continue;
+        }
+        key[start] = 0;
+        pq.push({0, start});
+        while (!pq.empty()) {
+            int current = pq.top().second;
+            pq.pop();
+            if (in_tree[current]) {
+                continue;
+            }
+            in_tree[current] = true;
+            if (link[current] >= 0) {
+                mst.push_back({link[current], current, key[current]});
+            }
+            for (int e = offsets[current]; e < offsets[current + 1]; ++e) {
+                int next = targets[e];
+                if (!in_tree[next] && distances[e] < key[next]) {
+                    key[next] = distances[e];
+                    link[next] = current;
+                    pq.push({distances[e], next});
+                }
+            }
+        }
+    }
+
+    return mst;
+}
+
+// Define MstAlgorithm enum for the dispatcher
+enum class MstAlgorithm { Kruskal, PrimHeap, PrimDense };
+
+// Function to choose an MST algorithm from the density of the loaded graph
+// Thresholds come from mst_density_bench.cpp: the O(V^2) Prim wins once routes cover about half of all
+// star pairs (its matrix is capped at 8192 stars, 512 MB), heap Prim beats sort-based Kruskal once the
+// average degree reaches about 16, and Kruskal is kept for sparse maps
+MstAlgorithm choose_mst_algorithm(size_t edge_count, int vertex_count) {
+    if (vertex_count < 2) {
+        return MstAlgorithm::Kruskal;
+    }
+    double pairs = 0.5 * vertex_count * (vertex_count - 1.0);
+    double density = edge_count / pairs;
+    double average_degree = 2.0 * edge_count / vertex_count;
+    if (vertex_count <= 8192 && density >= 0.5) {
+        return MstAlgorithm::PrimDense;
+    }
+    if (average_degree >= 16) {
+        return MstAlgorithm::PrimHeap;
+    }
+    return MstAlgorithm::Kruskal;
+}
+
+// Function to compute an MST with whichever algorithm suits the graph's density
+std::vector<KruskalEdge> minimum_spanning_tree(const std::vector<KruskalEdge> &edges, int vertex_count) {
+    switch (choose_mst_algorithm(edges.size(), vertex_count)) {
+        case MstAlgorithm::PrimDense:
+            return prim_dense(edges, vertex_count);
+        case MstAlgorithm::PrimHeap:
+            return prim_heap(edges, vertex_count);
+        default:
+            return kruskal(edges, vertex_count);
+    }
+}
+
+#endif // PRIM_MINIMUM_SPANNING_TREE_H
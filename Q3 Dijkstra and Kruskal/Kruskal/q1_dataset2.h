@@ -4,14 +4,16 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <string>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <algorithm>
 #include <unordered_set>
+#include "star_ids.h"
 
 struct Star {
-    char name;
+    std::string name;
     double x, y, z;
     int weight, profit;
 };
@@ -58,9 +60,9 @@ std::vector<Star> generate_stars(int count, long long int sum_of_ids) {
 
     std::vector<Star> stars;
     // Generate coordinates and random values for weight and profit for each star
-    for (char name = 'A'; name < 'A' + count; ++name) {
+    for (int i = 0; i < count; ++i) {
         Star star;
-        star.name = name;
+        star.name = generated_star_name(i);
         star.x = generate_unique_number(allowed_digits, 3);  // Random 3-digit number
         star.y = generate_unique_number(allowed_digits, 3);  // Random 3-digit number
         star.z = generate_unique_number(allowed_digits, 3);  // Random 3-digit number
@@ -78,20 +80,20 @@ double calculate_distance(double x1, double y1, double z1, double x2, double y2,
 }
 
 // Function to generate routes ensuring each star connects to at least 3 others
-// Function to generate routes ensuring connectivity
-std::vector<std::pair<char, char>> generate_routes(int count) {
-    std::vector<std::pair<char, char>> routes;
+// Function to generate routes ensuring connectivity, as pairs of star indices
+std::vector<std::pair<int, int>> generate_routes(int count) {
+    std::vector<std::pair<int, int>> routes;
 
     // Ensure each star connects to at least one other star
-    for (char i = 'A'; i < 'A' + count - 1; ++i) {
+    for (int i = 0; i < count - 1; ++i) {
         routes.push_back({i, i + 1});
     }
 
     // Add additional random connections to ensure diversity
     int additional_connections = 54 - (count - 1);
     while (additional_connections > 0) {
-        char name1 = 'A' + rand() % count;
-        char name2 = 'A' + rand() % count;
+        int name1 = rand() % count;
+        int name2 = rand() % count;
         if (name1 != name2 && std::find(routes.begin(), routes.end(), std::make_pair(name1, name2)) == routes.end() &&
             std::find(routes.begin(), routes.end(), std::make_pair(name2, name1)) == routes.end()) {
             routes.push_back(std::make_pair(name1, name2));
@@ -103,7 +105,7 @@ std::vector<std::pair<char, char>> generate_routes(int count) {
 
 
 // Function to save star dataset
-void save_star_dataset(const std::vector<Star> &stars, const std::vector<std::pair<char, char>> &routes, const std::string &filename) {
+void save_star_dataset(const std::vector<Star> &stars, const std::vector<std::pair<int, int>> &routes, const std::string &filename) {
     std::ofstream outfile(filename);
     if (!outfile.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
@@ -117,13 +119,10 @@ void save_star_dataset(const std::vector<Star> &stars, const std::vector<std::pa
 
     // Save route details with distances
     for (const auto &route : routes) {
-        Star star1, star2;
-        for (const auto &star : stars) {
-            if (star.name == route.first) star1 = star;
-            if (star.name == route.second) star2 = star;
-        }
+        const Star &star1 = stars[route.first];
+        const Star &star2 = stars[route.second];
         double distance = calculate_distance(star1.x, star1.y, star1.z, star2.x, star2.y, star2.z);
-        outfile << "Route " << route.first << "-" << route.second << " Distance: " << distance << std::endl;
+        outfile << "Route " << star1.name << "-" << star2.name << " Distance: " << distance << std::endl;
     }
 
     outfile.close();
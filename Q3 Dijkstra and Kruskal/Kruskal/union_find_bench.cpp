@@ -0,0 +1,70 @@
+// Build: g++ -O2 -std=c++17 -I../../common union_find_bench.cpp -o union_find_bench.exe
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+
+#include "kruskal.h"
+
+// Function to time a union-find strategy over the same edge sequence, printing the merge count
+template <typename Body>
+void time_strategy(const std::string &label, Body body) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+    long long merges = body();
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+    std::cout << label << ": " << duration.count() << " seconds, " << merges << " merges" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: union_find_bench [vertex_count] [edge_count] [block_size]
+    int vertex_count = argc >= 2 ? std::atoi(argv[1]) : 1000000;
+    int edge_count = argc >= 3 ? std::atoi(argv[2]) : 10000000;
+    int block_size = argc >= 4 ? std::atoi(argv[3]) : 4096;
+
+    // Random edges in random weight order, which is the order Kruskal's algorithm feeds them
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> pick(0, vertex_count - 1);
+    std::vector<int> from(edge_count), to(edge_count);
+    for (int i = 0; i < edge_count; ++i) {
+        from[i] = pick(rng);
+        to[i] = pick(rng);
+    }
+    std::cout << "Vertices: " << vertex_count << ", edges: " << edge_count << std::endl;
+
+    time_strategy("UnionFind (find, find, union_sets)", [&]() {
+        UnionFind uf(vertex_count);
+        long long merges = 0;
+        for (int i = 0; i < edge_count; ++i) {
+            if (uf.find(from[i]) != uf.find(to[i])) {
+                uf.union_sets(from[i], to[i]);
+                ++merges;
+            }
+        }
+        return merges;
+    });
+
+    time_strategy("DisjointSet (unite)", [&]() {
+        DisjointSet ds(vertex_count);
+        long long merges = 0;
+        for (int i = 0; i < edge_count; ++i) {
+            merges += ds.unite(from[i], to[i]);
+        }
+        return merges;
+    });
+
+    time_strategy("DisjointSet (unite_batch, block " + std::to_string(block_size) + ")", [&]() {
+        DisjointSet ds(vertex_count);
+        std::vector<unsigned char> merged(block_size);
+        long long merges = 0;
+        for (int begin = 0; begin < edge_count; begin += block_size) {
+            int count = std::min(block_size, edge_count - begin);
+            merges += ds.unite_batch(&from[begin], &to[begin], count, merged.data());
+        }
+        return merges;
+    });
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#ifndef BATCH_KNAPSACK_H
+#define BATCH_KNAPSACK_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include "knapsack_operations.h"
+#include "parallel_knapsack.h"
+
+// Many capacities from one DP pass: the last row of the DP up to the largest capacity W already holds the best
+// profit for every capacity c <= W, and the decision bits of knapsack_compact() can be walked back from column
+// c just as well as from column W. So one pass over the stars answers any number of capacity queries, each in
+// O(1) for the profit and O(n) for the selection.
+
+// Define KnapsackBatch struct: the last DP row and the shared decision bits for every capacity up to capacity
+struct KnapsackBatch {
+    int capacity = 0;
+    std::vector<int> best;       // best[c] is the best profit within capacity c
+    size_t words_per_row = 0;
+    std::vector<uint64_t> take;  // one row of decision bits per star; empty if selections were not kept
+};
+
+// Function to run the DP once up to the largest of the capacities
+// With keep_selection the n * (W + 1) decision bits are kept so knapsack_batch_answer() can return stars too;
+// without it only two rows are alive. With a pool, every row is split across its threads.
+KnapsackBatch knapsack_batch(const std::vector<Star> &stars, const std::vector<int> &capacities, bool keep_selection = true, ThreadPool *pool = nullptr) {
+    KnapsackBatch batch;
+    for (int c : capacities) {
+        batch.capacity = std::max(batch.capacity, c);
+    }
+    const int n = static_cast<int>(stars.size());
+    if (keep_selection) {
+        batch.words_per_row = (static_cast<size_t>(batch.capacity) + 64) / 64;
+        batch.take.assign(batch.words_per_row * n, 0);
+    }
+    uint64_t *take = keep_selection ? batch.take.data() : nullptr;
+
+    if (pool != nullptr && pool->size() > 1) {
+        parallel_profit_rows(stars, 0, n, batch.capacity, *pool, batch.best, take, batch.words_per_row);
+        return batch;
+    }
+    std::vector<int> next_row(batch.capacity + 1);
+    batch.best.assign(batch.capacity + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        knapsack_row_update(batch.best.data(), next_row.data(), stars[i].weight, stars[i].profit, batch.capacity,
+                            take != nullptr ? take + batch.words_per_row * i : nullptr);
+        batch.best.swap(next_row);
+    }
+    return batch;
+}
+
+// Function to answer one capacity from a batch: the best profit and, if the bits were kept, the stars
+// Capacities below 0 get nothing; capacities above the batch's are not covered and return a profit of -1.
+std::pair<int, std::vector<Star>> knapsack_batch_answer(const std::vector<Star> &stars, const KnapsackBatch &batch, int capacity) {
+    if (capacity > batch.capacity) {
+        return {-1, {}};
+    }
+    if (capacity < 0) {
+        return {0, {}};
+    }
+    std::vector<Star> selected_stars;
+    if (!batch.take.empty()) {
+        selected_stars = knapsack_traceback(stars, batch.take, batch.words_per_row, capacity);
+    }
+    return {batch.best[capacity], selected_stars};
+}
+
+// Function to parse a list of capacities such as "100,250,800" or "100:800:50" (from 100 to 800 in steps of 50)
+// Items of either form can be mixed in one comma-separated list; returns an empty list if any item is malformed
+// or negative.
+std::vector<int> parse_capacity_list(const std::string &text) {
+    std::vector<int> capacities;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        int first = 0, last = 0, step = 1;
+        char extra;
+        if (std::sscanf(item.c_str(), "%d:%d:%d%c", &first, &last, &step, &extra) == 3) {
+            if (first < 0 || step <= 0 || last < first) {
+                return {};
+            }
+            for (long long c = first; c <= last; c += step) {
+                capacities.push_back(static_cast<int>(c));
+            }
+        } else if (std::sscanf(item.c_str(), "%d%c", &first, &extra) == 1 && first >= 0) {
+            capacities.push_back(first);
+        } else {
+            return {};
+        }
+    }
+    return capacities;
+}
+
+#endif // BATCH_KNAPSACK_H
@@ -0,0 +1,244 @@
+#ifndef BRANCH_AND_BOUND_KNAPSACK_H
+#define BRANCH_AND_BOUND_KNAPSACK_H
+
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <algorithm>
+#include "knapsack_operations.h"
+
+// Exact branch and bound with no table at all, so the capacity can be anything that fits in an int.
+// Stars are sorted by profit / weight; the greedy fractional (Dantzig) solution of what is left is an upper
+// bound at every node, found by binary search on prefix sums. Depth-first search takes the next star
+// whenever it fits and backtracks to the last taken star once the bound cannot beat the best selection.
+// Core reduction: a star far from the greedy break point is fixed to its greedy value if flipping it alone
+// already caps the profit at the incumbent's, since then no better selection can flip it. The search then
+// only runs over the core of stars that could not be fixed.
+
+// Define BranchAndBoundResult struct
+struct BranchAndBoundResult {
+    int total_profit = 0;
+    std::vector<Star> selected_stars;
+    long long upper_bound = 0; // proven bound on the optimum; equals total_profit when optimal
+    bool optimal = true;       // false if the time limit stopped the search
+    long long nodes = 0;
+    int core_size = 0;
+};
+
+// Define RatioOrder struct: stars sorted by profit / weight with prefix sums for the fractional bound
+struct RatioOrder {
+    std::vector<int> star;                   // star index at each sorted position
+    std::vector<long long> weight, profit;   // per sorted position
+    std::vector<long long> weight_prefix, profit_prefix; // sums over positions [0, k)
+
+    // Function to bound the profit of positions [from, end) within capacity, leaving out position skip
+    long long fractional_bound(int from, int end, long long capacity, int skip = -1) const {
+        if (capacity < 0) {
+            return std::numeric_limits<long long>::min() / 2;
+        }
+        long long skip_weight = skip >= from && skip < end ? weight[skip] : 0;
+        long long skip_profit = skip >= from && skip < end ? profit[skip] : 0;
+        // Largest k whose prefix (without skip) fits; the prefix is monotone in k even with skip removed
+        int lo = from, hi = end;
+        while (lo < hi) {
+            int mid = lo + (hi - lo + 1) / 2;
+            long long used = weight_prefix[mid] - weight_prefix[from] - (skip >= from && skip < mid ? skip_weight : 0);
+            if (used <= capacity) {
+                lo = mid;
+            } else {
+                hi = mid - 1;
+            }
+        }
+        int k = lo;
+        long long used = weight_prefix[k] - weight_prefix[from] - (skip >= from && skip < k ? skip_weight : 0);
+        long long bound = profit_prefix[k] - profit_prefix[from] - (skip >= from && skip < k ? skip_profit : 0);
+        if (k < end && weight[k] > 0) {
+            bound += (capacity - used) * profit[k] / weight[k];
+        }
+        return bound;
+    }
+};
+
+// Function to sort stars by profit / weight, highest first (weightless stars first of all)
+RatioOrder make_ratio_order(const std::vector<Star> &stars) {
+    RatioOrder order;
+    int n = static_cast<int>(stars.size());
+    order.star.resize(n);
+    std::iota(order.star.begin(), order.star.end(), 0);
+    std::sort(order.star.begin(), order.star.end(), [&](int a, int b) {
+        // Weightless stars have no ratio and cross-multiplying would tie them with everything, so they go
+        // first, most profitable first
+        if ((stars[a].weight == 0) != (stars[b].weight == 0)) {
+            return stars[a].weight == 0;
+        }
+        if (stars[a].weight == 0) {
+            return stars[a].profit != stars[b].profit ? stars[a].profit > stars[b].profit : a < b;
+        }
+        // p_a / w_a > p_b / w_b without division
+        long long left = static_cast<long long>(stars[a].profit) * stars[b].weight;
+        long long right = static_cast<long long>(stars[b].profit) * stars[a].weight;
+        return left != right ? left > right : a < b;
+    });
+    order.weight.resize(n);
+    order.profit.resize(n);
+    order.weight_prefix.assign(n + 1, 0);
+    order.profit_prefix.assign(n + 1, 0);
+    for (int k = 0; k < n; ++k) {
+        order.weight[k] = stars[order.star[k]].weight;
+        order.profit[k] = stars[order.star[k]].profit;
+        order.weight_prefix[k + 1] = order.weight_prefix[k] + order.weight[k];
+        order.profit_prefix[k + 1] = order.profit_prefix[k] + order.profit[k];
+    }
+    return order;
+}
+
+// Function to search positions [begin, end) exhaustively, positions outside fixed by chosen
+// chosen must hold the incumbent on entry (best_profit is its profit) and holds the best selection found on exit.
+// Returns false if the deadline passed first.
+bool branch_and_bound_search(const RatioOrder &order, int begin, int end, long long capacity, std::vector<char> &chosen,
+                             long long &best_profit, long long &nodes, std::chrono::steady_clock::time_point deadline) {
+    // Profit and weight of the stars fixed outside the core
+    long long fixed_weight = 0, fixed_profit = 0;
+    for (int k = 0; k < static_cast<int>(chosen.size()); ++k) {
+        if ((k < begin || k >= end) && chosen[k]) {
+            fixed_weight += order.weight[k];
+            fixed_profit += order.profit[k];
+        }
+    }
+    long long room = capacity - fixed_weight;
+    if (room < 0) {
+        return true;
+    }
+
+    std::vector<char> current(end - begin, 0);
+    std::vector<int> taken; // positions currently taken, for backtracking
+    long long weight = 0, profit = fixed_profit;
+    int k = begin;
+    while (true) {
+        ++nodes;
+        if ((nodes & 4095) == 0 && std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        bool backtrack = false;
+        if (k == end) {
+            if (profit > best_profit) {
+                best_profit = profit;
+                std::copy(current.begin(), current.end(), chosen.begin() + begin);
+            }
+            backtrack = true;
+        } else if (profit + order.fractional_bound(k, end, room - weight) <= best_profit) {
+            backtrack = true;
+        } else if (order.weight[k] <= room - weight) {
+            current[k - begin] = 1;
+            taken.push_back(k);
+            weight += order.weight[k];
+            profit += order.profit[k];
+            ++k;
+        } else {
+            ++k;
+        }
+        if (backtrack) {
+            // Undo the last star taken and explore leaving it out
+            if (taken.empty()) {
+                return true;
+            }
+            int last = taken.back();
+            taken.pop_back();
+            current[last - begin] = 0;
+            weight -= order.weight[last];
+            profit -= order.profit[last];
+            k = last + 1;
+        }
+    }
+}
+
+// Function to solve the 0/1 Knapsack problem by branch and bound
+// Returns the same total profit as knapsack_compact() (the stars may differ when selections tie). With a time limit
+// (seconds, 0 for none) the best selection so far is returned with optimal = false and the bound it is
+// proven against, so (upper_bound - total_profit) / upper_bound is the optimality gap.
+BranchAndBoundResult knapsack_branch_and_bound(const std::vector<Star> &stars, int capacity, double time_limit = 0) {
+    auto deadline = time_limit > 0 ? std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(time_limit))
+                                   : std::chrono::steady_clock::time_point::max();
+    BranchAndBoundResult result;
+    RatioOrder order = make_ratio_order(stars);
+    const int n = static_cast<int>(stars.size());
+    if (n == 0 || capacity < 0) {
+        return result;
+    }
+    result.upper_bound = order.fractional_bound(0, n, capacity);
+
+    // Greedy incumbent: the prefix up to the break star, then any later star that still fits
+    std::vector<char> chosen(n, 0);
+    int split = 0;
+    long long room = capacity, best_profit = 0;
+    while (split < n && order.weight[split] <= room) {
+        chosen[split] = 1;
+        room -= order.weight[split];
+        best_profit += order.profit[split];
+        ++split;
+    }
+    for (int k = split; k < n; ++k) {
+        if (order.weight[k] <= room) {
+            chosen[k] = 1;
+            room -= order.weight[k];
+            best_profit += order.profit[k];
+        }
+    }
+
+    // A small core around the break star usually lifts the incumbent close to the optimum
+    const int initial_radius = 32;
+    int begin = std::max(0, split - initial_radius), end = std::min(n, split + initial_radius);
+    bool finished = branch_and_bound_search(order, begin, end, capacity, chosen, best_profit, result.nodes, deadline);
+
+    // Reduction: widen the core to every star whose flip could still beat the incumbent
+    if (finished) {
+        for (int k = 0; k < n; ++k) {
+            if (k >= begin && k < end) {
+                continue;
+            }
+            bool greedy_in = k < split;
+            long long flipped = greedy_in ? order.fractional_bound(0, n, capacity, k)
+                                          : order.profit[k] + order.fractional_bound(0, n, capacity - order.weight[k], k);
+            if (flipped > best_profit) {
+                begin = std::min(begin, k);
+                end = std::max(end, k + 1);
+            }
+        }
+        // Stars outside the core take their greedy-prefix value; the core search only keeps a selection that
+        // beats the incumbent, which stays the answer otherwise
+        std::vector<char> core_chosen = chosen;
+        for (int k = 0; k < n; ++k) {
+            if (k < begin || k >= end) {
+                core_chosen[k] = k < split;
+            }
+        }
+        long long core_best = best_profit;
+        finished = branch_and_bound_search(order, begin, end, capacity, core_chosen, core_best, result.nodes, deadline);
+        if (core_best > best_profit) {
+            chosen.swap(core_chosen);
+            best_profit = core_best;
+        }
+    }
+    result.core_size = end - begin;
+    result.optimal = finished;
+    result.total_profit = static_cast<int>(best_profit);
+    if (finished) {
+        result.upper_bound = best_profit;
+    }
+
+    std::vector<int> picked;
+    for (int k = 0; k < n; ++k) {
+        if (chosen[k]) {
+            picked.push_back(order.star[k]);
+        }
+    }
+    std::sort(picked.begin(), picked.end());
+    for (int i : picked) {
+        result.selected_stars.push_back(stars[i]);
+    }
+    return result;
+}
+
+#endif // BRANCH_AND_BOUND_KNAPSACK_H
@@ -0,0 +1,228 @@
+#ifndef DP_DUMP_H
+#define DP_DUMP_H
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include "knapsack_operations.h"
+
+// Binary dump of the knapsack DP table, written one row at a time while the DP runs so the table never has
+// to be held in memory. Layout:
+//   header | row 0 | row 1 | ... | row n | index
+// A raw row is capacity + 1 int32 values. A compressed row stores each value's difference from the one before
+// it (a DP row never decreases, so these are small) as a zigzag LEB128 varint, usually one byte per cell.
+// The index holds the byte offset of every row plus the end of the last one, so any row is one seek away;
+// the header is rewritten with the row count and index position when the dump is closed.
+
+const uint32_t DP_DUMP_MAGIC = 0x44504B44; // "DKPD"
+const uint32_t DP_DUMP_VERSION = 1;
+const uint32_t DP_DUMP_COMPRESSED = 1;     // flag: rows are delta + varint encoded
+
+// Define DpDumpHeader struct
+struct DpDumpHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t columns;
+    uint32_t flags;
+    uint64_t row_count;
+    uint64_t index_offset;
+};
+
+// Define DpDumpWriter struct: an open dump being written
+struct DpDumpWriter {
+    std::ofstream outfile;
+    DpDumpHeader header;
+    std::vector<uint64_t> offsets;
+    std::vector<uint8_t> buffer; // one encoded row
+};
+
+// Define DpDumpReader struct: an open dump with its row index loaded
+struct DpDumpReader {
+    std::ifstream infile;
+    DpDumpHeader header;
+    std::vector<uint64_t> offsets;
+    std::vector<uint8_t> buffer;
+};
+
+// Define DpWindow struct: an inclusive range of rows and columns
+struct DpWindow {
+    long long first_row, last_row, first_column, last_column;
+};
+
+// Function to start a dump of rows with the given number of columns
+bool open_dp_dump(const std::string &filename, uint32_t columns, bool compressed, DpDumpWriter &writer) {
+    writer.outfile.open(filename, std::ios::binary);
+    if (!writer.outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    writer.header = {DP_DUMP_MAGIC, DP_DUMP_VERSION, columns, compressed ? DP_DUMP_COMPRESSED : 0, 0, 0};
+    writer.outfile.write(reinterpret_cast<const char *>(&writer.header), sizeof(writer.header));
+    writer.offsets.assign(1, sizeof(DpDumpHeader));
+    return true;
+}
+
+// Function to append one row of header.columns values
+void write_dp_dump_row(DpDumpWriter &writer, const int *row) {
+    const uint32_t columns = writer.header.columns;
+    if (writer.header.flags & DP_DUMP_COMPRESSED) {
+        writer.buffer.clear();
+        int previous = 0;
+        for (uint32_t c = 0; c < columns; ++c) {
+            int32_t delta = static_cast<int32_t>(static_cast<uint32_t>(row[c]) - static_cast<uint32_t>(previous));
+            uint32_t value = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31); // zigzag
+            while (value >= 0x80) {
+                writer.buffer.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            writer.buffer.push_back(static_cast<uint8_t>(value));
+            previous = row[c];
+        }
+        writer.outfile.write(reinterpret_cast<const char *>(writer.buffer.data()), writer.buffer.size());
+        writer.offsets.push_back(writer.offsets.back() + writer.buffer.size());
+    } else {
+        writer.outfile.write(reinterpret_cast<const char *>(row), sizeof(int32_t) * columns);
+        writer.offsets.push_back(writer.offsets.back() + sizeof(int32_t) * columns);
+    }
+    ++writer.header.row_count;
+}
+
+// Function to write the index, finish the header and close the dump
+bool close_dp_dump(DpDumpWriter &writer) {
+    writer.header.index_offset = writer.offsets.back();
+    writer.outfile.write(reinterpret_cast<const char *>(writer.offsets.data()), sizeof(uint64_t) * writer.offsets.size());
+    writer.outfile.seekp(0);
+    writer.outfile.write(reinterpret_cast<const char *>(&writer.header), sizeof(writer.header));
+    writer.outfile.close();
+    return static_cast<bool>(writer.outfile);
+}
+
+// Function to open a dump for reading and load its row index
+bool open_dp_dump_reader(const std::string &filename, DpDumpReader &reader) {
+    reader.infile.open(filename, std::ios::binary);
+    if (!reader.infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    reader.infile.read(reinterpret_cast<char *>(&reader.header), sizeof(reader.header));
+    if (!reader.infile || reader.header.magic != DP_DUMP_MAGIC || reader.header.version != DP_DUMP_VERSION) {
+        std::cerr << "Not a DP dump: " << filename << std::endl;
+        return false;
+    }
+    reader.offsets.resize(reader.header.row_count + 1);
+    reader.infile.seekg(reader.header.index_offset);
+    reader.infile.read(reinterpret_cast<char *>(reader.offsets.data()), sizeof(uint64_t) * reader.offsets.size());
+    if (!reader.infile) {
+        std::cerr << "Truncated DP dump: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Function to read columns [first_column, last_column] of row r into values
+// A raw row is read from the first wanted cell; a compressed row is decoded from its start up to last_column.
+bool read_dp_dump_row(DpDumpReader &reader, uint64_t r, uint32_t first_column, uint32_t last_column, std::vector<int> &values) {
+    values.clear();
+    if (r >= reader.header.row_count || first_column > last_column || last_column >= reader.header.columns) {
+        return false;
+    }
+    if (!(reader.header.flags & DP_DUMP_COMPRESSED)) {
+        values.resize(last_column - first_column + 1);
+        reader.infile.seekg(reader.offsets[r] + sizeof(int32_t) * first_column);
+        reader.infile.read(reinterpret_cast<char *>(values.data()), sizeof(int32_t) * values.size());
+        return static_cast<bool>(reader.infile);
+    }
+    reader.buffer.resize(reader.offsets[r + 1] - reader.offsets[r]);
+    reader.infile.seekg(reader.offsets[r]);
+    reader.infile.read(reinterpret_cast<char *>(reader.buffer.data()), reader.buffer.size());
+    if (!reader.infile) {
+        return false;
+    }
+    size_t position = 0;
+    int value = 0;
+    for (uint32_t c = 0; c <= last_column; ++c) {
+        uint32_t zigzag = 0;
+        for (int shift = 0; position < reader.buffer.size(); shift += 7) {
+            uint8_t byte = reader.buffer[position++];
+            zigzag |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        value = static_cast<int>(static_cast<uint32_t>(value) + ((zigzag >> 1) ^ (0u - (zigzag & 1))));
+        if (c >= first_column) {
+            values.push_back(value);
+        }
+    }
+    return true;
+}
+
+// Function to parse a window such as "0:20,0:800" (rows 0 to 20, columns 0 to 800)
+// A missing end, as in "5:,100:", runs to the end of the table; returns false if the text is malformed.
+bool parse_dp_window(const std::string &text, DpWindow &window) {
+    window = {0, -1, 0, -1};
+    const char *s = text.c_str();
+    int used = 0;
+    if (std::sscanf(s, "%lld:%n", &window.first_row, &used) != 1 || used == 0) {
+        return false;
+    }
+    s += used;
+    if (*s != ',' && std::sscanf(s, "%lld%n", &window.last_row, &used) == 1) {
+        s += used;
+    }
+    used = 0;
+    if (std::sscanf(s, ",%lld:%n", &window.first_column, &used) != 1 || used == 0) {
+        return false;
+    }
+    s += used;
+    if (*s != '\0' && std::sscanf(s, "%lld%n", &window.last_column, &used) == 1) {
+        s += used;
+    }
+    return *s == '\0' && window.first_row >= 0 && window.first_column >= 0;
+}
+
+// Function to print a window of the dump as a text table with row and column headers
+// The window is clipped to the table, so it may ask for more rows or columns than there are.
+bool print_dp_window(DpDumpReader &reader, DpWindow window, std::ostream &out) {
+    long long last_row = static_cast<long long>(reader.header.row_count) - 1;
+    long long last_column = static_cast<long long>(reader.header.columns) - 1;
+    window.last_row = window.last_row < 0 ? last_row : std::min(window.last_row, last_row);
+    window.last_column = window.last_column < 0 ? last_column : std::min(window.last_column, last_column);
+    if (window.first_row < 0 || window.first_column < 0 || window.first_row > window.last_row || window.first_column > window.last_column) {
+        return false;
+    }
+
+    // Print column headers
+    out << "     "; // Space for row headers
+    for (long long col = window.first_column; col <= window.last_column; ++col) {
+        out << std::setw(4) << col << " ";
+    }
+    out << "\n";
+    // Print rows with row headers
+    std::vector<int> values;
+    for (long long i = window.first_row; i <= window.last_row; ++i) {
+        if (!read_dp_dump_row(reader, i, static_cast<uint32_t>(window.first_column), static_cast<uint32_t>(window.last_column), values)) {
+            return false;
+        }
+        out << std::setw(4) << i << " ";
+        for (int value : values) {
+            out << std::setw(4) << value << " ";
+        }
+        out << "\n";
+    }
+    return true;
+}
+
+// Function to solve the 0/1 Knapsack problem with knapsack_compact(), streaming every DP row to a dump
+// Gives the same profit and stars as knapsack_compact(); the dump holds the full DP table row for row.
+std::pair<int, std::vector<Star>> knapsack_dump(const std::vector<Star> &stars, int capacity, DpDumpWriter &writer) {
+    return knapsack_compact(stars, capacity, [&writer](const int *row) { write_dp_dump_row(writer, row); });
+}
+
+#endif // DP_DUMP_H
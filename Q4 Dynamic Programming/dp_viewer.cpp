@@ -0,0 +1,53 @@
+// Build: g++ -O2 -std=c++17 -march=native -I../common dp_viewer.cpp -o dp_viewer.exe
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+#include "dp_dump.h"
+
+int main(int argc, char *argv[])
+{
+    // Usage: dp_viewer dump_file [info | row R | column C | window ROWS,COLUMNS]
+    // Prints part of a DP table dumped by knapsack.exe without loading the rest of it: a row is one seek,
+    // and a column is one short read per row in a raw dump; a compressed row is decoded from its start up to
+    // the last wanted column. Windows use the same ROWS,COLUMNS form as knapsack's --table option.
+    if (argc < 2) {
+        std::cerr << "Usage: dp_viewer dump_file [info | row R | column C | window ROWS,COLUMNS]" << std::endl;
+        return 1;
+    }
+    DpDumpReader reader;
+    if (!open_dp_dump_reader(argv[1], reader)) {
+        return 1;
+    }
+    std::string command = argc >= 3 ? argv[2] : "info";
+
+    DpWindow window;
+    if (command == "info") {
+        std::cout << "Rows: " << reader.header.row_count << " (row 0 holds no stars, row i the first i stars, up to "
+                  << reader.header.row_count - 1 << ")\n";
+        std::cout << "Columns: " << reader.header.columns << " (capacities 0 to " << reader.header.columns - 1 << ")\n";
+        std::cout << "Encoding: " << (reader.header.flags & DP_DUMP_COMPRESSED ? "delta + varint" : "raw int32") << ", "
+                  << reader.header.index_offset << " bytes of rows\n";
+        return 0;
+    } else if (command == "row" && argc >= 4) {
+        long long r = std::atoll(argv[3]);
+        window = {r, r, 0, -1};
+    } else if (command == "column" && argc >= 4) {
+        long long c = std::atoll(argv[3]);
+        window = {0, -1, c, c};
+    } else if (command == "window" && argc >= 4) {
+        if (!parse_dp_window(argv[3], window)) {
+            std::cerr << "Invalid window: " << argv[3] << " (expected ROWS,COLUMNS such as 0:20,0:800)" << std::endl;
+            return 1;
+        }
+    } else {
+        std::cerr << "Unknown command: " << command << std::endl;
+        return 1;
+    }
+
+    if (!print_dp_window(reader, window, std::cout)) {
+        std::cerr << "Window is outside the table" << std::endl;
+        return 1;
+    }
+    return 0;
+}
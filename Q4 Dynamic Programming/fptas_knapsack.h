@@ -0,0 +1,155 @@
+#ifndef FPTAS_KNAPSACK_H
+#define FPTAS_KNAPSACK_H
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include "knapsack_operations.h"
+#include "branch_and_bound_knapsack.h"
+
+// Approximation scheme for the 0/1 knapsack: the result is within a factor (1 - epsilon) of the optimum, in time
+// polynomial in n and 1 / epsilon but independent of the capacity and the size of the profits.
+// LB is the better of the greedy ratio fill and the best single star, so LB <= OPT <= U (the fractional bound)
+// <= 2 LB. Stars worth more than epsilon * LB / 2 are "large": their profits are rounded down to multiples of
+// K = epsilon^2 * LB / 8 and a profit-indexed DP finds the lightest way to reach every rounded profit. A solution
+// holds at most 4 / epsilon large stars, so rounding loses at most epsilon * LB / 2. The rest of the capacity
+// is filled with "small" stars in ratio order, which loses at most one small star, another epsilon * LB / 2.
+// With many stars nearly all of them are small and the DP is tiny; among large stars with the same rounded
+// profit only the lightest few that could fit in one solution are kept.
+
+// Function to solve the 0/1 Knapsack problem to within a factor (1 - epsilon) of the best profit, 0 < epsilon < 1
+std::pair<int, std::vector<Star>> knapsack_fptas(const std::vector<Star> &stars, int capacity, double epsilon) {
+    RatioOrder order = make_ratio_order(stars);
+    const int n = static_cast<int>(stars.size());
+    if (n == 0 || capacity < 0) {
+        return {0, {}};
+    }
+
+    // Bounds on the optimum
+    long long greedy = 0, room = capacity, best_single = 0;
+    for (int k = 0; k < n; ++k) {
+        if (order.weight[k] <= room) {
+            greedy += order.profit[k];
+            room -= order.weight[k];
+        }
+        if (order.weight[k] <= capacity) {
+            best_single = std::max(best_single, order.profit[k]);
+        }
+    }
+    const double lower = static_cast<double>(std::max(greedy, best_single));
+    if (lower <= 0) {
+        return {0, {}};
+    }
+    const double upper = static_cast<double>(order.fractional_bound(0, n, capacity));
+    const double large_threshold = epsilon * lower / 2;
+    const double scale = epsilon * epsilon * lower / 8;
+    const long long top = static_cast<long long>(upper / scale); // highest rounded profit any solution reaches
+
+    // Split the stars (in ratio order) into small ones and rounded large ones
+    std::vector<int> small;                    // sorted positions
+    std::vector<std::pair<int, int>> large;    // (rounded profit, sorted position)
+    for (int k = 0; k < n; ++k) {
+        if (order.weight[k] > capacity) {
+            continue;
+        }
+        if (order.profit[k] > large_threshold) {
+            large.push_back({static_cast<int>(order.profit[k] / scale), k});
+        } else {
+            small.push_back(k);
+        }
+    }
+    // Per rounded profit v, a solution holds at most top / v stars of that value: keep the lightest ones
+    std::sort(large.begin(), large.end(), [&](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+        return a.first != b.first ? a.first < b.first : order.weight[a.second] < order.weight[b.second];
+    });
+    std::vector<std::pair<int, int>> kept;
+    for (size_t i = 0; i < large.size();) {
+        size_t j = i;
+        while (j < large.size() && large[j].first == large[i].first) {
+            ++j;
+        }
+        size_t limit = large[i].first > 0 ? static_cast<size_t>(top / large[i].first) : j - i;
+        kept.insert(kept.end(), large.begin() + i, large.begin() + i + std::min(j - i, limit));
+        i = j;
+    }
+
+    // Profit-indexed DP over the kept large stars: lightest weight reaching each rounded profit
+    long long profit_sum = 0;
+    for (const auto &[value, k] : kept) {
+        profit_sum += value;
+    }
+    const int columns = static_cast<int>(std::min(top, profit_sum)) + 1;
+    const long long unreachable = static_cast<long long>(capacity) + 1; // any weight over the capacity
+    std::vector<long long> lightest(columns, unreachable);
+    lightest[0] = 0;
+    size_t words_per_row = (static_cast<size_t>(columns) + 63) / 64;
+    std::vector<uint64_t> take(words_per_row * kept.size(), 0);
+    for (size_t i = 0; i < kept.size(); ++i) {
+        const int value = kept[i].first;
+        const long long weight = order.weight[kept[i].second];
+        uint64_t *bits = take.data() + words_per_row * i;
+        for (int p = columns - 1; p >= value; --p) {
+            // Beating the current weight also keeps within the capacity, since unreachable is capacity + 1
+            long long with = lightest[p - value] + weight;
+            if (with < lightest[p]) {
+                lightest[p] = with;
+                bits[p >> 6] |= uint64_t(1) << (p & 63);
+            }
+        }
+    }
+
+    // Small stars' prefix sums, to fill what each rounded profit leaves in O(log n)
+    std::vector<long long> small_weight(small.size() + 1, 0), small_profit(small.size() + 1, 0);
+    for (size_t i = 0; i < small.size(); ++i) {
+        small_weight[i + 1] = small_weight[i] + order.weight[small[i]];
+        small_profit[i + 1] = small_profit[i] + order.profit[small[i]];
+    }
+    int best_column = 0;
+    double best_value = -1;
+    for (int p = 0; p < columns; ++p) {
+        if (lightest[p] >= unreachable) {
+            continue;
+        }
+        size_t fit = std::upper_bound(small_weight.begin(), small_weight.end(), capacity - lightest[p]) - small_weight.begin() - 1;
+        double value = p * scale + small_profit[fit];
+        if (value > best_value) {
+            best_value = value;
+            best_column = p;
+        }
+    }
+
+    // Recover the large stars, then fill greedily with small stars in ratio order
+    std::vector<char> chosen(n, 0);
+    room = capacity;
+    for (int i = static_cast<int>(kept.size()) - 1, p = best_column; i >= 0 && p > 0; --i) {
+        if (take[words_per_row * i + (p >> 6)] >> (p & 63) & 1) {
+            chosen[kept[i].second] = 1;
+            room -= order.weight[kept[i].second];
+            p -= kept[i].first;
+        }
+    }
+    for (int k : small) {
+        if (order.weight[k] <= room) {
+            chosen[k] = 1;
+            room -= order.weight[k];
+        }
+    }
+
+    std::vector<int> picked;
+    for (int k = 0; k < n; ++k) {
+        if (chosen[k]) {
+            picked.push_back(order.star[k]);
+        }
+    }
+    std::sort(picked.begin(), picked.end());
+    std::vector<Star> selected_stars;
+    int total_profit = 0;
+    for (int i : picked) {
+        selected_stars.push_back(stars[i]);
+        total_profit += stars[i].profit;
+    }
+    return {total_profit, selected_stars};
+}
+
+#endif // FPTAS_KNAPSACK_H
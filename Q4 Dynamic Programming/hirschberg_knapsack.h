@@ -0,0 +1,83 @@
+#ifndef HIRSCHBERG_KNAPSACK_H
+#define HIRSCHBERG_KNAPSACK_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "knapsack_operations.h"
+#include "parallel_knapsack.h"
+
+// Divide and conquer over the stars (Hirschberg's trick applied to the knapsack): the best profit of the
+// first half at every capacity and of the second half at every capacity say how to split the capacity
+// between the halves, and each half is then solved on its own share. Only a few O(W) rows are alive at any
+// time, so the selection is recovered without the n * W decision bits, for about twice the row updates.
+// Ranges small enough that their decision bits fit in one row's worth of memory go to knapsack_compact().
+
+// Define HirschbergRows struct: the O(W) work rows shared by every level of the recursion
+struct HirschbergRows {
+    std::vector<int> forward, backward, scratch;
+    size_t leaf_bits; // largest (stars * (capacity + 1)) handed to knapsack_compact()
+    ThreadPool *pool; // splits each row's capacities across threads when set
+};
+
+// Function to fill row with the best profit of stars[begin, end) at every capacity up to capacity
+void knapsack_profit_row(const std::vector<Star> &stars, int begin, int end, int capacity, std::vector<int> &row, std::vector<int> &scratch, ThreadPool *pool) {
+    if (pool != nullptr && pool->size() > 1) {
+        parallel_profit_rows(stars, begin, end, capacity, *pool, row);
+        return;
+    }
+    std::fill(row.begin(), row.begin() + capacity + 1, 0);
+    for (int i = begin; i < end; ++i) {
+        knapsack_row_update(row.data(), scratch.data(), stars[i].weight, stars[i].profit, capacity, nullptr);
+        row.swap(scratch);
+    }
+}
+
+// Function to append the best selection from stars[begin, end) within capacity, in star order
+void hirschberg_select(const std::vector<Star> &stars, int begin, int end, int capacity, HirschbergRows &rows, std::vector<Star> &selected_stars) {
+    if (begin >= end || capacity < 0) {
+        return;
+    }
+    if (static_cast<size_t>(end - begin) * (capacity + 1) <= rows.leaf_bits) {
+        std::vector<Star> part(stars.begin() + begin, stars.begin() + end);
+        std::vector<Star> chosen = rows.pool != nullptr ? knapsack_compact_parallel(part, capacity, *rows.pool).second : knapsack_compact(part, capacity).second;
+        selected_stars.insert(selected_stars.end(), chosen.begin(), chosen.end());
+        return;
+    }
+
+    int mid = begin + (end - begin) / 2;
+    knapsack_profit_row(stars, begin, mid, capacity, rows.forward, rows.scratch, rows.pool);
+    knapsack_profit_row(stars, mid, end, capacity, rows.backward, rows.scratch, rows.pool);
+    int split = 0;
+    for (int c = 1; c <= capacity; ++c) {
+        if (rows.forward[c] + rows.backward[capacity - c] > rows.forward[split] + rows.backward[capacity - split]) {
+            split = c;
+        }
+    }
+
+    // The rows are free again once the split is known
+    hirschberg_select(stars, begin, mid, split, rows, selected_stars);
+    hirschberg_select(stars, mid, end, capacity - split, rows, selected_stars);
+}
+
+// Function to solve the 0/1 Knapsack problem in O(W) memory, reconstructing the selected stars
+// The total profit matches knapsack_compact(); when several selections tie, the stars chosen may differ.
+// With a pool, every row is split across its threads as in parallel_profit_rows().
+std::pair<int, std::vector<Star>> knapsack_hirschberg(const std::vector<Star> &stars, int capacity, ThreadPool *pool = nullptr) {
+    HirschbergRows rows;
+    rows.forward.assign(capacity + 1, 0);
+    rows.backward.assign(capacity + 1, 0);
+    rows.scratch.assign(capacity + 1, 0);
+    rows.leaf_bits = 32 * (static_cast<size_t>(capacity) + 1);
+    rows.pool = pool;
+
+    std::vector<Star> selected_stars;
+    hirschberg_select(stars, 0, static_cast<int>(stars.size()), capacity, rows, selected_stars);
+    int total_profit = 0;
+    for (const auto &star : selected_stars) {
+        total_profit += star.profit;
+    }
+    return {total_profit, selected_stars};
+}
+
+#endif // HIRSCHBERG_KNAPSACK_H
@@ -0,0 +1,116 @@
+#ifndef INCREMENTAL_KNAPSACK_H
+#define INCREMENTAL_KNAPSACK_H
+
+#include <vector>
+#include <algorithm>
+#include "knapsack_operations.h"
+
+// Define IncrementalKnapsack struct
+// Keeps the knapsack answer for a fixed capacity W while stars are added or removed one at a time.
+// The DP rows form a stack: row i is the best profit of the first i stars at every capacity, so adding a star
+// is one row update, O(W), and removing the newest star only drops a row. Removing star k for good has to
+// redo the rows above it, O((n - k) * W), so older stars are the expensive ones to edit.
+// Asking what the best load would be without star k needs no rebuild: with prefix row k (the stars before k)
+// and suffix row k + 1 (the stars after k), the best profit at capacity c is the max over a of
+// prefix[a] + suffix[c - a], O(W). The suffix rows are built by the first such query after an edit,
+// O(n * W), and shared by every query until the next edit.
+// Memory: the n + 1 prefix rows are the whole (n + 1) * (W + 1) DP table, 4 bytes a cell, and the suffix rows
+// double that once a what-if query has been asked; n = 2000 and W = 10^6 would need 8 GB, then 16 GB. This is
+// meant for interactive edits at modest capacities; knapsack_compact() or knapsack_batch() solve large
+// capacities in two rows and one bit per cell. Keeping every prefix row makes decision bits unnecessary: the
+// selection is read off by comparing each row with the one before it.
+struct IncrementalKnapsack {
+    int capacity;
+    size_t columns;
+    std::vector<Star> stars;
+    std::vector<int> rows;        // n + 1 prefix rows of capacity + 1 columns
+    std::vector<int> suffix;      // n + 1 suffix rows: row i is the best over stars[i..n)
+    bool suffix_valid = false;
+    long long last_update_work = 0; // row updates done by the most recent edit or query
+
+    IncrementalKnapsack(int knapsack_capacity)
+        : capacity(std::max(knapsack_capacity, 0)), columns(capacity + 1), rows(columns, 0) {
+    }
+
+    // Function to add a star after the others
+    void add_star(const Star &star) {
+        stars.push_back(star);
+        push_row(stars.size() - 1);
+        suffix_valid = false;
+        last_update_work = 1;
+    }
+
+    // Function to remove star k, redoing the rows of the stars after it
+    void remove_star(int k) {
+        stars.erase(stars.begin() + k);
+        rows.resize(columns * (k + 1));
+        for (size_t i = k; i < stars.size(); ++i) {
+            push_row(i);
+        }
+        suffix_valid = false;
+        last_update_work = static_cast<long long>(stars.size()) - k;
+    }
+
+    // Function to return the best profit of all stars within capacity c (at most the knapsack's capacity)
+    int best_profit(int c) const {
+        return c < 0 ? 0 : rows[columns * stars.size() + std::min(c, capacity)];
+    }
+
+    // Function to return the best selection of all stars within capacity c, in star order
+    // Star i was taken wherever its prefix row beats the row before it, as in a full DP table
+    std::vector<Star> best_selection(int c) const {
+        std::vector<Star> selected_stars;
+        if (c < 0) {
+            return selected_stars;
+        }
+        size_t w = std::min(c, capacity);
+        for (size_t i = stars.size(); i > 0; --i) {
+            if (rows[columns * i + w] != rows[columns * (i - 1) + w]) {
+                selected_stars.push_back(stars[i - 1]);
+                w -= stars[i - 1].weight;
+            }
+        }
+        std::reverse(selected_stars.begin(), selected_stars.end());
+        return selected_stars;
+    }
+
+    // Function to return the best profit within capacity c if star k were left out
+    int profit_without(int k, int c) {
+        if (c < 0) {
+            return 0;
+        }
+        c = std::min(c, capacity);
+        last_update_work = 0;
+        build_suffix_rows();
+        const int *before = rows.data() + columns * k;
+        const int *after = suffix.data() + columns * (k + 1);
+        int best = 0;
+        for (int a = 0; a <= c; ++a) {
+            best = std::max(best, before[a] + after[c - a]);
+        }
+        return best;
+    }
+
+private:
+    // Function to append the prefix row of star i, built from the row before it
+    void push_row(size_t i) {
+        rows.resize(columns * (i + 2));
+        knapsack_row_update(rows.data() + columns * i, rows.data() + columns * (i + 1), stars[i].weight, stars[i].profit, capacity, nullptr);
+    }
+
+    // Function to rebuild the suffix rows if an edit has made them stale
+    void build_suffix_rows() {
+        if (suffix_valid) {
+            return;
+        }
+        const size_t n = stars.size();
+        suffix.assign(columns * (n + 1), 0);
+        for (size_t i = n; i-- > 0;) {
+            knapsack_row_update(suffix.data() + columns * (i + 1), suffix.data() + columns * i, stars[i].weight, stars[i].profit, capacity, nullptr);
+        }
+        suffix_valid = true;
+        last_update_work = static_cast<long long>(n);
+    }
+};
+
+#endif // INCREMENTAL_KNAPSACK_H
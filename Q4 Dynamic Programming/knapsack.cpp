@@ -1,85 +1,25 @@
+// Build: g++ -O2 -std=c++17 -march=native -pthread -I../common knapsack.cpp -o knapsack.exe
 #include <iostream>
 #include <fstream>
 #include <vector>
 #include <string>
-#include <tuple>
 #include <iomanip>
-#include <algorithm>
-#include <unordered_set>
 #include <chrono>
-
-// Structure to represent a Star
-struct Star {
-    char name;
-    double x, y, z;
-    int weight, profit;
-};
-
-// Function to read stars from a file
-std::vector<Star> read_stars(const std::string &filename) {
-    std::ifstream infile(filename);
-    std::vector<Star> stars;
-    std::unordered_set<char> star_names; // To keep track of added star names
-
-    if (infile.is_open()) {
-        std::string line;
-        while (std::getline(infile, line)) {
-            Star star;
-            std::sscanf(line.c_str(), "Star %c %lf %lf %lf %d %d", &star.name, &star.x, &star.y, &star.z, &star.weight, &star.profit);
-            
-            // Check if the star name has already been added
-            if (star_names.find(star.name) == star_names.end()) {
-                stars.push_back(star);
-                star_names.insert(star.name); // Add the star name to the set
-            }
-        }
-        infile.close();
-    } else {
-        std::cerr << "Error opening file: " << filename << std::endl;
-    }
-    return stars;
-}
-
-// Function to solve the 0/1 Knapsack problem using Dynamic Programming
-std::tuple<int, std::vector<Star>, std::vector<std::vector<int>>> knapsack(const std::vector<Star> &stars, int capacity) {
-    int n = stars.size();
-    std::vector<std::vector<int>> dp(n + 1, std::vector<int>(capacity + 1, 0));
-
-    // Build the DP table
-    for (int i = 1; i <= n; ++i) {
-        for (int w = 1; w <= capacity; ++w) {
-            if (stars[i - 1].weight <= w) {
-                dp[i][w] = std::max(dp[i - 1][w], dp[i - 1][w - stars[i - 1].weight] + stars[i - 1].profit);
-            } else {
-                dp[i][w] = dp[i - 1][w];
-            }
-        }
-    }
-
-    // Find the stars to include in the knapsack
-    std::vector<Star> selected_stars;
-    int w = capacity;
-    for (int i = n; i > 0 && w > 0; --i) {
-        if (dp[i][w] != dp[i - 1][w]) {
-            selected_stars.push_back(stars[i - 1]);
-            w -= stars[i - 1].weight; // Decrease the remaining capacity
-        }
-    }
-
-    // Reverse the selected stars since we iterated backwards
-    std::reverse(selected_stars.begin(), selected_stars.end());
-
-    // Calculate the total profit
-    int total_profit = 0;
-    for (const auto &star : selected_stars) {
-        total_profit += star.profit;
-    }
-
-    return {dp[n][capacity], selected_stars, dp};
-}
+#include <cstdlib>
+#include <algorithm>
+#include "knapsack_operations.h"
+#include "hirschberg_knapsack.h"
+#include "parallel_knapsack.h"
+#include "pareto_knapsack.h"
+#include "branch_and_bound_knapsack.h"
+#include "fptas_knapsack.h"
+#include "batch_knapsack.h"
+#include "incremental_knapsack.h"
+#include "dp_dump.h"
 
 // Function to save the result to a file
-void save_result(const std::vector<std::vector<int>> &dp, const std::vector<Star> &selected_stars, int total_profit, const std::string &filename) {
+// With a window, that part of the DP table is read back from the dump and appended as text.
+void save_result(const std::vector<Star> &selected_stars, int total_profit, const std::string &filename, const std::string &dump_filename, const DpWindow *window) {
     std::ofstream outfile(filename);
     if (!outfile.is_open()) {
         std::cerr << "Error opening file: " << filename << std::endl;
@@ -102,19 +42,36 @@ void save_result(const std::vector<std::vector<int>> &dp, const std::vector<Star
         outfile << "Star " << star.name << " Weight: " << star.weight << " kg, Profit: " << star.profit << "\n";
     }
 
-    // Save the DP matrix
-    outfile << "\nDynamic programming table:\n";
-    // Print column headers
-    outfile << "     "; // Space for row headers
-    for (int col = 0; col <= 800; ++col) {
-        outfile << std::setw(4) << col << " ";
+    // Save the requested window of the DP matrix
+    if (window != nullptr) {
+        DpDumpReader reader;
+        outfile << "\nDynamic programming table:\n";
+        if (!open_dp_dump_reader(dump_filename, reader) || !print_dp_window(reader, *window, outfile)) {
+            std::cerr << "Could not print the DP table window from " << dump_filename << std::endl;
+        }
+    }
+
+    outfile.close();
+    std::cout << "Result saved to " << filename << std::endl;
+}
+
+// Function to save the answer for every capacity of a batch to a file, one line per capacity
+void save_batch_result(const std::vector<Star> &stars, const KnapsackBatch &batch, const std::vector<int> &capacities, const std::string &filename) {
+    std::ofstream outfile(filename);
+    if (!outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return;
     }
-    outfile << "\n";
-    // Print rows with row headers
-    for (int i = 0; i < dp.size(); ++i) {
-        outfile << std::setw(4) << i << " ";
-        for (int j = 0; j <= 800; ++j) {
-            outfile << std::setw(4) << dp[i][j] << " ";
+
+    for (int capacity : capacities) {
+        auto [total_profit, selected_stars] = knapsack_batch_answer(stars, batch, capacity);
+        int total_weight = 0;
+        for (const auto &star : selected_stars) {
+            total_weight += star.weight;
+        }
+        outfile << "Capacity: " << capacity << " kg, Total Weight: " << total_weight << " kg, Total Profit: " << total_profit << ", Stars:";
+        for (const auto &star : selected_stars) {
+            outfile << " " << star.name;
         }
         outfile << "\n";
     }
@@ -123,30 +80,172 @@ void save_result(const std::vector<std::vector<int>> &dp, const std::vector<Star
     std::cout << "Result saved to " << filename << std::endl;
 }
 
-int main() {
-    std::string filename = "dataset2_1.txt";
-    int capacity = 800;
+int main(int argc, char *argv[]) {
+    // Usage: knapsack [dataset] [full|compact|hirschberg|pareto|auto|bnb|fptas|batch|incremental] [capacity] [threads] [time_limit|epsilon] [options] -- a .snap file is read as a binary snapshot
+    // "full" streams every DP row to a binary dump (knapsack_dp.bin unless --dump FILE is given, delta + varint
+    // encoded with --compress) instead of keeping the table; dp_viewer.exe reads rows, columns or windows back.
+    // --table ROWS,COLUMNS (e.g. 0:20,0:800) also writes that window of the table as text to knapsack_result.txt
+    // "compact" keeps two DP rows and the decision bits instead of the whole table, which is then not saved;
+    // "hirschberg" keeps only O(W) rows and splits the stars in halves to recover the selection
+    // "pareto" keeps only non-dominated (weight, profit) states; "auto" picks it or compact from the estimated work
+    // "bnb" is branch and bound with no table; with a time limit (seconds) it may stop early and report its gap
+    // "fptas" returns a selection within (1 - epsilon) of the best profit, epsilon 0.01 unless given
+    // "batch" takes a list of capacities ("100,250,800" or "100:800:50") and answers them all from one DP pass
+    // "incremental" adds the stars one at a time, then reports the best profit without each star in turn
+    // With more than one thread the compact and hirschberg modes split every row's capacities across a pool
+    std::vector<std::string> args;
+    std::string dump_filename = "knapsack_dp.bin";
+    bool compress = false;
+    bool table = false;
+    DpWindow window;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--dump" && i + 1 < argc) {
+            dump_filename = argv[++i];
+        } else if (arg == "--compress") {
+            compress = true;
+        } else if (arg == "--table" && i + 1 < argc) {
+            table = true;
+            if (!parse_dp_window(argv[++i], window)) {
+                std::cerr << "Invalid table window: " << argv[i] << " (expected ROWS,COLUMNS such as 0:20,0:800)" << std::endl;
+                return 1;
+            }
+        } else if (arg.compare(0, 2, "--") == 0) {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        } else {
+            args.push_back(arg);
+        }
+    }
+    std::string filename = args.size() >= 1 ? args[0] : "dataset2_1.txt";
+    std::string mode = args.size() >= 2 ? args[1] : "full";
+    std::vector<int> capacities = args.size() >= 3 ? parse_capacity_list(args[2]) : std::vector<int>{800};
+    int capacity = capacities.empty() ? 0 : *std::max_element(capacities.begin(), capacities.end());
+    int threads = args.size() >= 4 ? std::atoi(args[3].c_str()) : 1;
+    double time_limit = args.size() >= 5 ? std::atof(args[4].c_str()) : 0;
+    double epsilon = args.size() >= 5 ? std::atof(args[4].c_str()) : 0.01;
+    if (mode != "full" && mode != "compact" && mode != "hirschberg" && mode != "pareto" && mode != "auto" && mode != "bnb" && mode != "fptas" && mode != "batch" && mode != "incremental") {
+        std::cerr << "Unknown mode: " << mode << " (expected full, compact, hirschberg, pareto, auto, bnb, fptas, batch or incremental)" << std::endl;
+        return 1;
+    }
+    if (capacities.empty() || *std::min_element(capacities.begin(), capacities.end()) < 0) {
+        std::cerr << "Invalid capacity: " << args[2] << " (expected a capacity of 0 or more, or a list of them)" << std::endl;
+        return 1;
+    }
+    if (mode != "batch" && capacities.size() > 1) {
+        std::cerr << "Invalid capacity: " << args[2] << " (lists of capacities need the batch mode)" << std::endl;
+        return 1;
+    }
+    if (table && mode != "full") {
+        std::cerr << "--table needs the full mode, the only one that keeps the DP table" << std::endl;
+        return 1;
+    }
+    if (mode == "fptas" && (epsilon <= 0 || epsilon >= 1)) {
+        std::cerr << "epsilon must be between 0 and 1" << std::endl;
+        return 1;
+    }
 
     auto start_time = std::chrono::high_resolution_clock::now(); // Start timing
 
-    std::vector<Star> stars = read_stars(filename);
+    std::vector<Star> stars = is_snapshot_file(filename) ? read_stars_snapshot(filename) : read_stars(filename);
 
     // Solve the knapsack problem
-    auto [max_profit, selected_stars, dp] = knapsack(stars, capacity);
+    int max_profit;
+    std::vector<Star> selected_stars;
+    ThreadPool pool(threads);
+    if (mode == "compact") {
+        std::tie(max_profit, selected_stars) = pool.size() > 1 ? knapsack_compact_parallel(stars, capacity, pool) : knapsack_compact(stars, capacity);
+    } else if (mode == "hirschberg") {
+        std::tie(max_profit, selected_stars) = knapsack_hirschberg(stars, capacity, pool.size() > 1 ? &pool : nullptr);
+    } else if (mode == "pareto") {
+        std::tie(max_profit, selected_stars) = knapsack_pareto(stars, capacity);
+    } else if (mode == "auto") {
+        std::tie(max_profit, selected_stars) = knapsack_auto(stars, capacity);
+    } else if (mode == "bnb") {
+        BranchAndBoundResult result = knapsack_branch_and_bound(stars, capacity, time_limit);
+        max_profit = result.total_profit;
+        selected_stars = result.selected_stars;
+        if (!result.optimal) {
+            std::cout << "Time limit reached: best profit " << result.total_profit << ", upper bound " << result.upper_bound
+                      << ", gap " << 100.0 * (result.upper_bound - result.total_profit) / std::max(1LL, result.upper_bound) << "%\n";
+        }
+    } else if (mode == "fptas") {
+        std::tie(max_profit, selected_stars) = knapsack_fptas(stars, capacity, epsilon);
+    } else if (mode == "batch") {
+        KnapsackBatch batch = knapsack_batch(stars, capacities, true, pool.size() > 1 ? &pool : nullptr);
+        save_batch_result(stars, batch, capacities, "knapsack_batch_result.txt");
+        std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+        std::cout << "Answered " << capacities.size() << " capacities from one pass\n";
+        std::cout << "Execution Time: " << duration.count() << " seconds\n";
+        std::cout << "Time Complexity: O(n * W + q * n) for q capacities up to W = " << capacity << ", n = " << stars.size() << "\n";
+        return 0;
+    } else if (mode == "incremental") {
+        IncrementalKnapsack incremental(capacity);
+        for (const auto &star : stars) {
+            incremental.add_star(star);
+        }
+        max_profit = incremental.best_profit(capacity);
+        selected_stars = incremental.best_selection(capacity);
+        for (int k = 0; k < static_cast<int>(stars.size()); ++k) {
+            int without = incremental.profit_without(k, capacity);
+            std::cout << "Without star " << stars[k].name << ": best profit " << without << " (" << without - max_profit << ")\n";
+        }
+    } else {
+        DpDumpWriter writer;
+        if (!open_dp_dump(dump_filename, static_cast<uint32_t>(capacity + 1), compress, writer)) {
+            return 1;
+        }
+        std::tie(max_profit, selected_stars) = knapsack_dump(stars, capacity, writer);
+        if (!close_dp_dump(writer)) {
+            std::cerr << "Error writing file: " << dump_filename << std::endl;
+            return 1;
+        }
+    }
 
     auto end_time = std::chrono::high_resolution_clock::now(); // End timing
     std::chrono::duration<double> duration = end_time - start_time;
 
     // Save the result to a file
-    save_result(dp, selected_stars, max_profit, "knapsack_result.txt");
+    save_result(selected_stars, max_profit, "knapsack_result.txt", dump_filename, table ? &window : nullptr);
+    if (mode == "full") {
+        std::cout << "DP table saved to " << dump_filename << "\n";
+    }
 
     // Output time and space complexity
     int n = stars.size();
-    int space_complexity = sizeof(int) * (n + 1) * (capacity + 1); // DP table space complexity
+    size_t space_complexity = sizeof(int) * static_cast<size_t>(n + 1) * (capacity + 1); // DP table space complexity
+    std::string space_order = "O(n * W)";
+    if (mode == "incremental") {
+        space_complexity = sizeof(int) * static_cast<size_t>(n + 1) * (capacity + 1) * 2; // prefix and suffix rows
+    } else if (mode == "compact" || mode == "full") {
+        space_complexity = sizeof(int) * static_cast<size_t>(capacity + 1) * 2 + sizeof(uint64_t) * n * ((static_cast<size_t>(capacity) + 64) / 64); // two rows plus decision bits
+    } else if (mode == "hirschberg") {
+        space_complexity = sizeof(int) * static_cast<size_t>(capacity + 1) * 6; // three work rows, plus two rows and a row's worth of bits at the leaves
+        space_order = "O(W)";
+    }
 
     std::cout << "Execution Time: " << duration.count() << " seconds\n";
-    std::cout << "Time Complexity: O(n * W), where n = " << n << " and W = " << capacity << "\n";
-    std::cout << "Space Complexity: O(n * W), requiring " << space_complexity / 1024 << " KB\n"; // Convert bytes to KB
+    if (mode == "bnb") {
+        std::cout << "Time Complexity: O(n log n) to sort, then exponential in the core in the worst case; Space Complexity: O(n), where n = " << n << "\n";
+        return 0;
+    }
+    if (mode == "fptas") {
+        std::cout << "Time Complexity: O(n log n + m / epsilon^2), Space Complexity: O(n + m / epsilon^2) bits, with epsilon = " << epsilon
+                  << ", n = " << n << " and m <= min(n, log(1 / epsilon) / epsilon^2) large stars\n";
+        return 0;
+    }
+    if (mode == "pareto" || mode == "auto") {
+        // The sparse solver's cost depends on how many states survive, which is only bounded up front
+        std::cout << "Time and Space Complexity: O(Pareto states), at most " << estimate_pareto_states(stars, capacity)
+                  << " states for n = " << n << " and W = " << capacity << "\n";
+        return 0;
+    }
+    if (mode == "incremental") {
+        std::cout << "Time Complexity: O(W) per added star, O(W) per what-if query after an O(n * W) suffix pass, where n = " << n << " and W = " << capacity << "\n";
+    } else {
+        std::cout << "Time Complexity: O(n * W), where n = " << n << " and W = " << capacity << "\n";
+    }
+    std::cout << "Space Complexity: " << space_order << ", requiring " << space_complexity / 1024 << " KB\n"; // Convert bytes to KB
 
     return 0;
 }
@@ -0,0 +1,58 @@
+// Build: g++ -O2 -std=c++17 -march=native -I../common knapsack_kernel_bench.cpp -o knapsack_kernel_bench.exe
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+
+#include "knapsack_row_kernel.h"
+
+// Define RowKernel type: the signature shared by the scalar and vector row updates
+typedef void (*RowKernel)(const int *, int *, int, int, int, uint64_t *);
+
+// Function to time a row kernel over a run of random stars, returning seconds per row
+double time_kernel(RowKernel kernel, std::vector<int> prev, std::vector<int> &next, std::vector<uint64_t> &take,
+                   const std::vector<std::pair<int, int>> &stars, int capacity, bool with_take)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    for (const auto &[weight, profit] : stars) {
+        kernel(prev.data(), next.data(), weight, profit, capacity, with_take ? take.data() : nullptr);
+        prev.swap(next);
+    }
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+    next.swap(prev);
+    return duration.count() / stars.size();
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: knapsack_kernel_bench [capacity] [rows]
+    // Times the scalar row update against the vector kernel compiled into this build, and checks they agree
+    int capacity = argc >= 2 ? std::atoi(argv[1]) : 4000000;
+    int rows = argc >= 3 ? std::atoi(argv[2]) : 50;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> weight(1, capacity / 10 + 1), profit(1, 1000);
+    std::vector<std::pair<int, int>> stars(rows);
+    for (auto &star : stars) {
+        star = {weight(rng), profit(rng)};
+    }
+    std::vector<int> start_row(capacity + 1, 0);
+    size_t words = (static_cast<size_t>(capacity) + 64) / 64;
+
+    // Each row reads two int arrays and writes one
+    double bytes_per_row = 3.0 * sizeof(int) * (capacity + 1);
+    std::cout << "Capacity: " << capacity << ", rows: " << rows << ", vector kernel: " << knapsack_row_kernel_name() << std::endl;
+    std::cout << "kernel  take_bits  ms_per_row  GB_per_s" << std::endl;
+    for (bool with_take : {false, true}) {
+        std::vector<int> scalar_row(capacity + 1), vector_row(capacity + 1);
+        std::vector<uint64_t> scalar_take(words, 0), vector_take(words, 0);
+        double scalar_seconds = time_kernel(knapsack_row_update_scalar, start_row, scalar_row, scalar_take, stars, capacity, with_take);
+        double vector_seconds = time_kernel(knapsack_row_update, start_row, vector_row, vector_take, stars, capacity, with_take);
+        std::cout << "scalar  " << with_take << "  " << scalar_seconds * 1e3 << "  " << bytes_per_row / scalar_seconds / 1e9 << std::endl;
+        std::cout << knapsack_row_kernel_name() << "  " << with_take << "  " << vector_seconds * 1e3 << "  " << bytes_per_row / vector_seconds / 1e9
+                  << (scalar_row == vector_row && scalar_take == vector_take ? "" : "  <-- results differ") << std::endl;
+    }
+
+    return 0;
+}
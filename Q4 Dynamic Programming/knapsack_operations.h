@@ -0,0 +1,122 @@
+#ifndef KNAPSACK_OPERATIONS_H
+#define KNAPSACK_OPERATIONS_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <random>
+#include "graph_snapshot.h"
+#include "knapsack_row_kernel.h"
+
+// Structure to represent a Star
+struct Star {
+    std::string name;
+    double x, y, z;
+    int weight, profit;
+};
+
+// Function to read stars from a file
+std::vector<Star> read_stars(const std::string &filename) {
+    std::ifstream infile(filename);
+    std::vector<Star> stars;
+    std::unordered_set<std::string> star_names; // To keep track of added star names
+
+    if (infile.is_open()) {
+        std::string line;
+        while (std::getline(infile, line)) {
+            Star star;
+            if (!parse_star_line(line, star.name, star.x, star.y, star.z, star.weight, star.profit)) {
+                continue; // Route lines and anything else that is not a star
+            }
+
+            // Check if the star name has already been added
+            if (star_names.find(star.name) == star_names.end()) {
+                stars.push_back(star);
+                star_names.insert(star.name); // Add the star name to the set
+            }
+        }
+        infile.close();
+    } else {
+        std::cerr << "Error opening file: " << filename << std::endl;
+    }
+    return stars;
+}
+
+// Function to read stars from a binary snapshot
+std::vector<Star> read_stars_snapshot(const std::string &filename) {
+    std::vector<Star> stars;
+    GraphSnapshot snapshot;
+    if (!open_graph_snapshot(filename, snapshot)) {
+        return stars;
+    }
+
+    stars.reserve(snapshot.star_count);
+    for (uint64_t i = 0; i < snapshot.star_count; ++i) {
+        stars.push_back({snapshot_star_name(snapshot, i), snapshot.x[i], snapshot.y[i], snapshot.z[i], snapshot.weight[i], snapshot.profit[i]});
+    }
+
+    close_graph_snapshot(snapshot);
+    return stars;
+}
+
+// Function to generate random stars for benchmarks, named "#0", "#1", ...
+std::vector<Star> generate_random_stars(int count, int max_weight, int max_profit, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> weight(1, max_weight), profit(1, max_profit);
+    std::vector<Star> stars(count);
+    for (int i = 0; i < count; ++i) {
+        stars[i].name = "#" + std::to_string(i);
+        stars[i].x = stars[i].y = stars[i].z = 0;
+        stars[i].weight = weight(rng);
+        stars[i].profit = profit(rng);
+    }
+    return stars;
+}
+
+// Function to recover the selected stars from packed "take" bits, one row of words_per_row words per star
+std::vector<Star> knapsack_traceback(const std::vector<Star> &stars, const std::vector<uint64_t> &take, size_t words_per_row, int capacity) {
+    // Walk the decision bits back from the last star
+    std::vector<Star> selected_stars;
+    int w = capacity;
+    for (int i = static_cast<int>(stars.size()) - 1; i >= 0; --i) {
+        if (take[words_per_row * i + (w >> 6)] >> (w & 63) & 1) {
+            selected_stars.push_back(stars[i]);
+            w -= stars[i].weight;
+        }
+    }
+    std::reverse(selected_stars.begin(), selected_stars.end());
+    return selected_stars;
+}
+
+// Function to solve the 0/1 Knapsack problem keeping two DP rows and a 1-bit "take" decision per cell
+// Each star's row is built from the previous one and the two swap roles; the decision bits
+// (n * (capacity + 1) bits in all) are enough to recover the selection, which needs about 1/32 of the
+// memory of the full (n + 1) x (capacity + 1) table. The other exact solvers are checked against this one.
+// If given, on_row(row) sees every row of that table in order, row 0 (no stars) first, while it is built.
+std::pair<int, std::vector<Star>> knapsack_compact(const std::vector<Star> &stars, int capacity, const std::function<void(const int *)> &on_row = nullptr) {
+    int n = stars.size();
+    size_t words_per_row = (static_cast<size_t>(capacity) + 64) / 64;
+    std::vector<int> row(capacity + 1, 0), next_row(capacity + 1);
+    std::vector<uint64_t> take(words_per_row * n, 0);
+
+    if (on_row) {
+        on_row(row.data());
+    }
+    for (int i = 0; i < n; ++i) {
+        knapsack_row_update(row.data(), next_row.data(), stars[i].weight, stars[i].profit, capacity, take.data() + words_per_row * i);
+        row.swap(next_row);
+        if (on_row) {
+            on_row(row.data());
+        }
+    }
+
+    return {row[capacity], knapsack_traceback(stars, take, words_per_row, capacity)};
+}
+
+#endif // KNAPSACK_OPERATIONS_H
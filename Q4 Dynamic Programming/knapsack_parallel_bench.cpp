@@ -0,0 +1,63 @@
+// Build: g++ -O2 -std=c++17 -march=native -pthread -I../common knapsack_parallel_bench.cpp -o knapsack_parallel_bench.exe
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+
+#include "knapsack_operations.h"
+#include "parallel_knapsack.h"
+
+int main(int argc, char *argv[])
+{
+    // Usage: knapsack_parallel_bench [max_threads [max_capacity [cells_per_run]]]
+    // For capacities 10^5, 10^6, ... the same stars are run through the DP on 1, 2, 4, ... threads.
+    // The star count is chosen so every run updates about cells_per_run cells; the rows are checked
+    // against the single-threaded knapsack_row_update() loop.
+    int max_threads = argc >= 2 ? std::atoi(argv[1]) : std::max(1u, std::thread::hardware_concurrency());
+    long long max_capacity = argc >= 3 ? std::atoll(argv[2]) : 100000000;
+    double cells_per_run = argc >= 4 ? std::atof(argv[3]) : 2e9;
+
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    std::cout << "Row kernel: " << knapsack_row_kernel_name() << std::endl;
+    std::cout << "capacity  stars  threads  seconds  Gcells_per_s  speedup" << std::endl;
+    for (long long capacity = 100000; capacity <= max_capacity; capacity *= 10) {
+        int star_count = static_cast<int>(std::max(4.0, cells_per_run / capacity));
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> weight(1, static_cast<int>(capacity / 20) + 1), profit(1, 1000);
+        std::vector<Star> stars(star_count);
+        for (auto &star : stars) {
+            star.weight = weight(rng);
+            star.profit = profit(rng);
+        }
+
+        // Reference row from the plain loop
+        std::vector<int> expected(capacity + 1, 0), scratch(capacity + 1);
+        for (const auto &star : stars) {
+            knapsack_row_update(expected.data(), scratch.data(), star.weight, star.profit, static_cast<int>(capacity), nullptr);
+            expected.swap(scratch);
+        }
+        std::vector<int>().swap(scratch);
+
+        double single = 0;
+        for (int threads : thread_counts) {
+            ThreadPool pool(threads);
+            std::vector<int> row;
+            auto start_time = std::chrono::high_resolution_clock::now();
+            parallel_profit_rows(stars, 0, star_count, static_cast<int>(capacity), pool, row);
+            std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+            if (threads == 1) {
+                single = duration.count();
+            }
+            std::cout << capacity << "  " << star_count << "  " << threads << "  " << duration.count() << "  "
+                      << static_cast<double>(star_count) * (capacity + 1) / duration.count() / 1e9 << "  " << single / duration.count()
+                      << (row == expected ? "" : "  <-- rows differ") << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#ifndef KNAPSACK_ROW_KERNEL_H
+#define KNAPSACK_ROW_KERNEL_H
+
+#include <cstdint>
+#include <algorithm>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+// One DP row for one star: next[w] = max(prev[w], prev[w - weight] + profit) for weight <= w <= capacity,
+// and next[w] = prev[w] below the weight. A star of weight 0 updates column 0 too, so it is always taken.
+// If take is given, bit w of it is set wherever taking the star is strictly better (bits are only ever set,
+// so it must start zeroed). prev and next must not overlap. The _range versions fill columns [begin, end)
+// only, so a row can be split between threads; ranges starting on a multiple of 64 never share a take word.
+// The vector kernels are chosen at compile time: build with -mavx2 or -mavx512f (or -march=native)
+// to get them; otherwise knapsack_row_update() is the scalar loop.
+
+// Function to update part of a row one capacity at a time, from w = begin up to end (exclusive)
+void knapsack_row_span_scalar(const int *prev, int *next, int weight, int profit, int begin, int end, uint64_t *take) {
+    for (int w = begin; w < end; ++w) {
+        int with = prev[w - weight] + profit;
+        bool better = with > prev[w];
+        next[w] = better ? with : prev[w];
+        if (take != nullptr && better) {
+            take[w >> 6] |= uint64_t(1) << (w & 63);
+        }
+    }
+}
+
+// Function to update columns [begin, end) of a row with the scalar loop only; the reference for the vector kernels
+void knapsack_row_update_scalar_range(const int *prev, int *next, int weight, int profit, int begin, int end, uint64_t *take) {
+    int first = std::min(std::max(weight, begin), end);
+    std::copy(prev + begin, prev + first, next + begin);
+    knapsack_row_span_scalar(prev, next, weight, profit, first, end, take);
+}
+
+// Function to update a whole row with the scalar loop only
+void knapsack_row_update_scalar(const int *prev, int *next, int weight, int profit, int capacity, uint64_t *take) {
+    knapsack_row_update_scalar_range(prev, next, weight, profit, 0, capacity + 1, take);
+}
+
+#if defined(__AVX512F__)
+// Function to update columns [begin, end) of a row 16 capacities at a time with AVX-512
+void knapsack_row_update_vector_range(const int *prev, int *next, int weight, int profit, int begin, int end, uint64_t *take) {
+    int first = std::min(std::max(weight, begin), end);
+    std::copy(prev + begin, prev + first, next + begin);
+    // Scalar head up to a multiple of 16, so each lane mask lands inside one take word
+    int w = std::min((first + 15) & ~15, end);
+    knapsack_row_span_scalar(prev, next, weight, profit, first, w, take);
+    const __m512i add = _mm512_set1_epi32(profit);
+    for (; w + 16 <= end; w += 16) {
+        __m512i keep = _mm512_loadu_si512(prev + w);
+        __m512i with = _mm512_add_epi32(_mm512_loadu_si512(prev + w - weight), add);
+        __mmask16 better = _mm512_cmpgt_epi32_mask(with, keep);
+        _mm512_storeu_si512(next + w, _mm512_mask_blend_epi32(better, keep, with));
+        if (take != nullptr) {
+            take[w >> 6] |= uint64_t(better) << (w & 63);
+        }
+    }
+    knapsack_row_span_scalar(prev, next, weight, profit, w, end, take);
+}
+#elif defined(__AVX2__)
+// Function to update columns [begin, end) of a row 8 capacities at a time with AVX2
+void knapsack_row_update_vector_range(const int *prev, int *next, int weight, int profit, int begin, int end, uint64_t *take) {
+    int first = std::min(std::max(weight, begin), end);
+    std::copy(prev + begin, prev + first, next + begin);
+    // Scalar head up to a multiple of 8, so each lane mask lands inside one take word
+    int w = std::min((first + 7) & ~7, end);
+    knapsack_row_span_scalar(prev, next, weight, profit, first, w, take);
+    const __m256i add = _mm256_set1_epi32(profit);
+    for (; w + 8 <= end; w += 8) {
+        __m256i keep = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(prev + w));
+        __m256i with = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(prev + w - weight)), add);
+        __m256i better = _mm256_cmpgt_epi32(with, keep);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(next + w), _mm256_blendv_epi8(keep, with, better));
+        if (take != nullptr) {
+            uint64_t bits = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(better)));
+            take[w >> 6] |= bits << (w & 63);
+        }
+    }
+    knapsack_row_span_scalar(prev, next, weight, profit, w, end, take);
+}
+#endif
+
+// Function to name the kernel knapsack_row_update() uses in this build
+const char *knapsack_row_kernel_name() {
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#else
+    return "scalar";
+#endif
+}
+
+// Function to update columns [begin, end) of a row with the widest kernel this build supports
+void knapsack_row_update_range(const int *prev, int *next, int weight, int profit, int begin, int end, uint64_t *take) {
+#if defined(__AVX2__) || defined(__AVX512F__)
+    knapsack_row_update_vector_range(prev, next, weight, profit, begin, end, take);
+#else
+    knapsack_row_update_scalar_range(prev, next, weight, profit, begin, end, take);
+#endif
+}
+
+// Function to update a whole row with the widest kernel this build supports
+void knapsack_row_update(const int *prev, int *next, int weight, int profit, int capacity, uint64_t *take) {
+    knapsack_row_update_range(prev, next, weight, profit, 0, capacity + 1, take);
+}
+
+#endif // KNAPSACK_ROW_KERNEL_H
@@ -0,0 +1,162 @@
+// Build: g++ -O2 -std=c++17 -march=native -I../common knapsack_solver_bench.cpp -o knapsack_solver_bench.exe
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <cstdlib>
+#include <random>
+
+#include "knapsack_operations.h"
+#include "pareto_knapsack.h"
+#include "branch_and_bound_knapsack.h"
+#include "fptas_knapsack.h"
+
+// Define BenchInstance struct: one generated instance family
+struct BenchInstance {
+    int star_count, capacity, max_weight, max_profit;
+};
+
+// Function to time one solver, printing its profit against the reference and returning seconds
+template <typename Solver>
+double time_solver(const std::string &label, int expected_profit, Solver solver)
+{
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::pair<int, std::vector<Star>> result = solver();
+    std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+    std::cout << "  " << label << ": " << duration.count() << " seconds, profit " << result.first
+              << (result.first == expected_profit ? "" : "  <-- differs from the dense DP") << std::endl;
+    return duration.count();
+}
+
+// Function to tell whether a selection fits in capacity and is worth exactly profit
+bool valid_selection(const std::vector<Star> &selected_stars, int capacity, int profit)
+{
+    long long total_weight = 0, total_profit = 0;
+    for (const auto &star : selected_stars) {
+        total_weight += star.weight;
+        total_profit += star.profit;
+    }
+    return total_weight <= capacity && total_profit == profit;
+}
+
+// Function to check the table-free solvers against an exhaustive search on small instances, and the FPTAS
+// against its (1 - epsilon) guarantee
+// The instances mix in stars of weight 0, of profit 0 and of both, and a third of them have capacity 0,
+// the cases the ratio order and the "nothing fits" shortcuts have to get right. Returns the wrong answers.
+int check_edge_cases(int instance_count)
+{
+    std::mt19937 rng(11);
+    int wrong = 0;
+    for (int t = 0; t < instance_count; ++t) {
+        std::vector<Star> stars(1 + rng() % 12);
+        for (size_t i = 0; i < stars.size(); ++i) {
+            stars[i].name = "#" + std::to_string(i);
+            stars[i].weight = rng() % 4 == 0 ? 0 : static_cast<int>(rng() % 30);
+            stars[i].profit = rng() % 4 == 0 ? 0 : static_cast<int>(rng() % 40);
+        }
+        int capacity = rng() % 3 == 0 ? 0 : static_cast<int>(rng() % 60);
+
+        int best = 0;
+        for (uint32_t subset = 0; subset < (1u << stars.size()); ++subset) {
+            int weight = 0, profit = 0;
+            for (size_t i = 0; i < stars.size(); ++i) {
+                if (subset >> i & 1) {
+                    weight += stars[i].weight;
+                    profit += stars[i].profit;
+                }
+            }
+            if (weight <= capacity) {
+                best = std::max(best, profit);
+            }
+        }
+
+        BranchAndBoundResult exact = knapsack_branch_and_bound(stars, capacity);
+        auto pareto = knapsack_pareto(stars, capacity);
+        auto automatic = knapsack_auto(stars, capacity);
+        wrong += !(exact.optimal && exact.total_profit == best && valid_selection(exact.selected_stars, capacity, best));
+        wrong += !(pareto.first == best && valid_selection(pareto.second, capacity, best));
+        wrong += !(automatic.first == best && valid_selection(automatic.second, capacity, best));
+        for (double epsilon : {0.5, 0.1, 0.01}) {
+            auto approximate = knapsack_fptas(stars, capacity, epsilon);
+            wrong += !(approximate.first >= (1 - epsilon) * best && valid_selection(approximate.second, capacity, approximate.first));
+        }
+    }
+    return wrong;
+}
+
+int main(int argc, char *argv[])
+{
+    // Usage: knapsack_solver_bench [star_count capacity max_weight max_profit]
+    // Without arguments a few instance families are run, from "few useful weight sums" to "dense is best",
+    // followed by branch and bound and the FPTAS on instances too large for any table.
+    // Small edge-case instances are always checked against an exhaustive search first.
+    const int edge_case_count = 20000;
+    int wrong = check_edge_cases(edge_case_count);
+    std::cout << "Edge cases: " << edge_case_count << " small instances, " << wrong << " wrong answers"
+              << (wrong == 0 ? "" : "  <-- solvers disagree with exhaustive search") << std::endl;
+
+    std::vector<BenchInstance> instances = {
+        {100, 10000000, 1000000, 100},     // huge capacity, few stars
+        {200, 1000000, 100000, 100},       // small profits: few distinct profit values
+        {1000, 1000000, 100000, 1000000},  // random profits: the state bound is loose
+        {2000, 100000, 10000, 1000},       // many stars and moderate capacity: dense wins
+    };
+    if (argc >= 5) {
+        instances = {{std::atoi(argv[1]), std::atoi(argv[2]), std::atoi(argv[3]), std::atoi(argv[4])}};
+    }
+
+    for (const auto &instance : instances) {
+        std::vector<Star> stars = generate_random_stars(instance.star_count, instance.max_weight, instance.max_profit, 42);
+        int capacity = instance.capacity;
+        std::cout << "Stars: " << instance.star_count << ", capacity: " << capacity << ", weights up to " << instance.max_weight
+                  << ", profits up to " << instance.max_profit << std::endl;
+        std::cout << "  dense cells: " << static_cast<double>(stars.size()) * (capacity + 1.0) << ", Pareto state bound: "
+                  << estimate_pareto_states(stars, capacity) << ", chosen: "
+                  << (choose_knapsack_solver(stars, capacity) == KnapsackSolver::Sparse ? "sparse" : "sparse within a budget, else dense") << std::endl;
+
+        int expected = knapsack_compact(stars, capacity).first;
+        time_solver("dense (knapsack_compact)", expected, [&]() { return knapsack_compact(stars, capacity); });
+        time_solver("sparse (knapsack_pareto)", expected, [&]() { return knapsack_pareto(stars, capacity); });
+        time_solver("auto", expected, [&]() { return knapsack_auto(stars, capacity); });
+        time_solver("branch and bound", expected, [&]() {
+            BranchAndBoundResult result = knapsack_branch_and_bound(stars, capacity);
+            return std::make_pair(result.total_profit, result.selected_stars);
+        });
+        for (double epsilon : {0.1, 0.01}) {
+            auto start_time = std::chrono::high_resolution_clock::now();
+            int profit = knapsack_fptas(stars, capacity, epsilon).first;
+            std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+            std::cout << "  FPTAS, epsilon " << epsilon << ": " << duration.count() << " seconds, profit " << profit << ", "
+                      << 100.0 * profit / expected << "% of optimal" << (profit < (1 - epsilon) * expected ? "  <-- below the guarantee" : "") << std::endl;
+        }
+    }
+
+    // A million stars with half the total weight as capacity; uncorrelated profits reduce to a tiny core,
+    // while profit = weight + constant is the classic hard case and runs into the time limit
+    if (argc < 5) {
+        for (bool correlated : {false, true}) {
+            std::vector<Star> stars = generate_random_stars(1000000, 1000, 1000, 7);
+            long long total_weight = 0;
+            for (auto &star : stars) {
+                if (correlated) {
+                    star.profit = star.weight + 100;
+                }
+                total_weight += star.weight;
+            }
+            int capacity = static_cast<int>(total_weight / 2);
+            auto start_time = std::chrono::high_resolution_clock::now();
+            BranchAndBoundResult result = knapsack_branch_and_bound(stars, capacity, 2.0);
+            std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start_time;
+            std::cout << "Branch and bound, 1000000 " << (correlated ? "correlated" : "uncorrelated") << " stars, capacity " << capacity
+                      << ", 2 second limit: " << duration.count() << " seconds, profit " << result.total_profit << ", bound " << result.upper_bound
+                      << (result.optimal ? " (optimal)" : " (gap " + std::to_string(100.0 * (result.upper_bound - result.total_profit) / result.upper_bound) + "%)")
+                      << ", core " << result.core_size << ", nodes " << result.nodes << std::endl;
+            start_time = std::chrono::high_resolution_clock::now();
+            int profit = knapsack_fptas(stars, capacity, 0.01).first;
+            duration = std::chrono::high_resolution_clock::now() - start_time;
+            std::cout << "FPTAS, epsilon 0.01: " << duration.count() << " seconds, profit " << profit << ", at least "
+                      << 100.0 * profit / result.upper_bound << "% of optimal" << std::endl;
+        }
+    }
+
+    return wrong == 0 ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+#ifndef PARALLEL_KNAPSACK_H
+#define PARALLEL_KNAPSACK_H
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <algorithm>
+#include "knapsack_operations.h"
+#include "thread_pool.h"
+
+// The capacity range is cut into one contiguous chunk per thread, each starting on a multiple of 64 so no two
+// threads write the same cache line or take word. There is no barrier between rows: a thread publishes the
+// last row it finished, and starts row r on its chunk once
+//   - every chunk that row r reads from (the columns chunk_begin - weight .. chunk_end) has finished row r - 1;
+//   - every chunk to its right has finished row r - 2.
+// Rows rotate through three buffers, and the second rule stops a thread from overwriting row r - 3 while a
+// thread to its right may still be reading it. The slowest thread can always move on, so chunks drift at most
+// a couple of rows apart and short rows on one thread are absorbed by the others.
+
+// Define KnapsackProgress struct: the last row a thread has finished (-1 until its part of the zero row is
+// written), alone on its cache line
+struct alignas(64) KnapsackProgress {
+    std::atomic<int> row{-1};
+};
+
+// Function to run the DP over stars[begin, end) from an all-zero row, splitting the capacities across the pool
+// The last row is copied into the first capacity + 1 entries of row, which grows if it is shorter.
+// If take is given, star begin + i sets its decision bits in take[words_per_row * i ...], as in knapsack_compact().
+void parallel_profit_rows(const std::vector<Star> &stars, int begin, int end, int capacity, ThreadPool &pool,
+                          std::vector<int> &row, uint64_t *take = nullptr, size_t words_per_row = 0) {
+    const int columns = capacity + 1;
+    const int min_chunk = 4096; // below this the waiting costs more than the row update it splits
+    int chunks = std::max(1, std::min(pool.size(), columns / min_chunk));
+    std::vector<int> bounds(chunks + 1);
+    for (int t = 0; t <= chunks; ++t) {
+        bounds[t] = std::min(columns, static_cast<int>(static_cast<long long>(columns) * t / chunks + 63) & ~63);
+    }
+    bounds[chunks] = columns;
+
+    std::vector<int> buffers[3];
+    for (auto &buffer : buffers) {
+        buffer.resize(columns);
+    }
+    std::vector<KnapsackProgress> progress(chunks);
+    const int rows = end - begin;
+
+    pool.run([&](int t) {
+        if (t >= chunks) {
+            return;
+        }
+        const int lo = bounds[t], hi = bounds[t + 1];
+        std::fill(buffers[0].begin() + lo, buffers[0].begin() + hi, 0);
+        progress[t].row.store(0, std::memory_order_release);
+        for (int r = 1; r <= rows; ++r) {
+            const Star &star = stars[begin + r - 1];
+            // Chunks this row reads from must have finished the previous row
+            for (int s = t - 1; s >= 0 && bounds[s + 1] > lo - std::max(star.weight, 0); --s) {
+                while (progress[s].row.load(std::memory_order_acquire) < r - 1) {
+                    std::this_thread::yield();
+                }
+            }
+            // Chunks to the right must be done reading the buffer this row overwrites
+            for (int s = t + 1; s < chunks; ++s) {
+                while (progress[s].row.load(std::memory_order_acquire) < r - 2) {
+                    std::this_thread::yield();
+                }
+            }
+            knapsack_row_update_range(buffers[(r - 1) % 3].data(), buffers[r % 3].data(), star.weight, star.profit, lo, hi,
+                                      take != nullptr ? take + words_per_row * (r - 1) : nullptr);
+            progress[t].row.store(r, std::memory_order_release);
+        }
+    });
+
+    if (row.size() < static_cast<size_t>(columns)) {
+        row.resize(columns);
+    }
+    std::copy(buffers[rows % 3].begin(), buffers[rows % 3].end(), row.begin());
+}
+
+// Function to solve the 0/1 Knapsack problem like knapsack_compact(), splitting every row across the pool
+std::pair<int, std::vector<Star>> knapsack_compact_parallel(const std::vector<Star> &stars, int capacity, ThreadPool &pool) {
+    size_t words_per_row = (static_cast<size_t>(capacity) + 64) / 64;
+    std::vector<uint64_t> take(words_per_row * stars.size(), 0);
+    std::vector<int> row;
+    parallel_profit_rows(stars, 0, static_cast<int>(stars.size()), capacity, pool, row, take.data(), words_per_row);
+    return {row[capacity], knapsack_traceback(stars, take, words_per_row, capacity)};
+}
+
+#endif // PARALLEL_KNAPSACK_H
@@ -0,0 +1,135 @@
+#ifndef PARETO_KNAPSACK_H
+#define PARETO_KNAPSACK_H
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include "knapsack_operations.h"
+
+// Sparse knapsack (Nemhauser-Ullmann): after each star only the non-dominated (weight, profit) states are kept,
+// i.e. the list sorted by weight has strictly increasing profit. Adding a star shifts a copy of the list by
+// the star's (weight, profit) and merges the two sorted lists in one linear pass. The work is the total list
+// length rather than n * capacity, which wins when weights and the capacity are large but few weight sums
+// are worth keeping (small profits, or few stars).
+
+// Define ParetoState struct: one kept (weight, profit) state and how it was reached
+struct ParetoState {
+    long long weight;
+    long long profit;
+    int32_t parent; // state this one extends, -1 for the empty selection
+    int32_t star;   // star added to the parent
+};
+
+// Function to solve the 0/1 Knapsack problem over the Pareto frontier of (weight, profit) states
+// Returns the same total profit as knapsack_compact() (the stars may differ when selections tie). Gives up and
+// returns a profit of -1 once the frontiers have held more than state_limit states in total.
+std::pair<int, std::vector<Star>> knapsack_pareto(const std::vector<Star> &stars, int capacity,
+                                                  size_t state_limit = std::numeric_limits<size_t>::max()) {
+    size_t states_seen = 0;
+    // Every state that survived a merge lives in pool; the frontier lists refer to it by index
+    std::vector<ParetoState> pool = {{0, 0, -1, -1}};
+    std::vector<int32_t> frontier = {0}, merged;
+
+    for (int i = 0; i < static_cast<int>(stars.size()); ++i) {
+        const Star &star = stars[i];
+        merged.clear();
+        merged.reserve(frontier.size() * 2);
+        const size_t m = frontier.size();
+        size_t a = 0, b = 0; // a walks the list without the star, b the same list with the star added
+        long long best_profit = -1;
+        while (true) {
+            if (b < m && pool[frontier[b]].weight + star.weight > capacity) {
+                b = m; // the shifted list is sorted by weight, so nothing further fits
+            }
+            if (a == m && b == m) {
+                break;
+            }
+            bool use_skip = b == m;
+            if (a < m && b < m) {
+                const ParetoState &skip = pool[frontier[a]], &take = pool[frontier[b]];
+                long long take_weight = take.weight + star.weight;
+                use_skip = skip.weight < take_weight || (skip.weight == take_weight && skip.profit >= take.profit + star.profit);
+            }
+            // A state is kept only if it beats the profit of every lighter state already kept
+            if (use_skip) {
+                if (pool[frontier[a]].profit > best_profit) {
+                    best_profit = pool[frontier[a]].profit;
+                    merged.push_back(frontier[a]);
+                }
+                ++a;
+            } else {
+                long long take_weight = pool[frontier[b]].weight + star.weight;
+                long long take_profit = pool[frontier[b]].profit + star.profit;
+                if (take_profit > best_profit) {
+                    best_profit = take_profit;
+                    pool.push_back({take_weight, take_profit, frontier[b], i});
+                    merged.push_back(static_cast<int32_t>(pool.size() - 1));
+                }
+                ++b;
+            }
+        }
+        frontier.swap(merged);
+        states_seen += frontier.size();
+        if (states_seen > state_limit) {
+            return {-1, {}};
+        }
+    }
+
+    // The heaviest kept state has the highest profit; walk its parents back to the empty selection
+    std::vector<Star> selected_stars;
+    int32_t best = frontier.back();
+    for (int32_t s = best; pool[s].parent >= 0; s = pool[s].parent) {
+        selected_stars.push_back(stars[pool[s].star]);
+    }
+    std::reverse(selected_stars.begin(), selected_stars.end());
+    return {static_cast<int>(pool[best].profit), selected_stars};
+}
+
+// Function to bound the number of Pareto states the sparse solver will touch
+// After i stars the frontier has at most min(2^i, capacity + 1, total profit so far + 1) entries: one per
+// subset, per weight and per profit value. The bound is exact for worst cases and loose for easy ones.
+double estimate_pareto_states(const std::vector<Star> &stars, int capacity) {
+    double states = 1, total = 0;
+    long long profit_sum = 0;
+    for (const auto &star : stars) {
+        profit_sum += std::max(star.profit, 0);
+        states = std::min({states * 2, static_cast<double>(capacity) + 1, static_cast<double>(profit_sum) + 1});
+        total += states;
+    }
+    return total;
+}
+
+// Define KnapsackSolver enum for the dispatcher
+enum class KnapsackSolver { Dense, Sparse };
+
+// A merge step costs about 100 vectorised dense cells (10 ns per Pareto state against 0.1 ns per cell with the
+// AVX-512 row kernel, measured with knapsack_solver_bench.cpp); the scalar kernel is slower per cell, which
+// only makes the sparse side's share more conservative
+const double PARETO_STATE_COST_IN_CELLS = 100;
+
+// Function to choose between the dense row DP and the sparse Pareto solver from their estimated work
+// Sparse is chosen only when even the worst-case state bound is cheaper than the dense table
+KnapsackSolver choose_knapsack_solver(const std::vector<Star> &stars, int capacity) {
+    double dense_cells = static_cast<double>(stars.size()) * (static_cast<double>(capacity) + 1);
+    double sparse_states = estimate_pareto_states(stars, capacity);
+    return sparse_states * PARETO_STATE_COST_IN_CELLS < dense_cells ? KnapsackSolver::Sparse : KnapsackSolver::Dense;
+}
+
+// Function to solve the 0/1 Knapsack problem with whichever of the dense and sparse solvers looks cheaper
+// The state bound is loose for random profits, so when it points to dense the sparse solver still gets a
+// budget of half the dense work and the dense solver only runs if that runs out.
+std::pair<int, std::vector<Star>> knapsack_auto(const std::vector<Star> &stars, int capacity) {
+    if (choose_knapsack_solver(stars, capacity) == KnapsackSolver::Sparse) {
+        return knapsack_pareto(stars, capacity);
+    }
+    double dense_cells = static_cast<double>(stars.size()) * (static_cast<double>(capacity) + 1);
+    auto result = knapsack_pareto(stars, capacity, static_cast<size_t>(dense_cells / PARETO_STATE_COST_IN_CELLS / 2));
+    if (result.first >= 0) {
+        return result;
+    }
+    return knapsack_compact(stars, capacity);
+}
+
+#endif // PARETO_KNAPSACK_H
@@ -0,0 +1,306 @@
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <algorithm>
+#include "star_ids.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Binary snapshot of a star dataset, shared by the Dijkstra, Kruskal and knapsack programs
+// Layout (every section starts on an 8-byte boundary):
+//   header | name_offsets | name_bytes | x | y | z | weight | profit | offsets | targets | distances | route_from | route_to | route_distance
+// Stars are stored as a struct of arrays indexed by star id; star i's name is name_bytes[name_offsets[i], name_offsets[i + 1]).
+// offsets/targets/distances hold both directions of every route in CSR order, and the route_* arrays keep each route
+// once in file order for edge-list algorithms
+
+const uint32_t GRAPH_SNAPSHOT_MAGIC = 0x4E535453; // "STSN"
+const uint32_t GRAPH_SNAPSHOT_VERSION = 2; // 2: names are strings instead of one char per star
+
+// Define GraphSnapshotHeader struct
+struct GraphSnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t star_count;
+    uint64_t route_count;
+};
+
+// Define GraphSnapshotData struct: owned arrays, used to build and write a snapshot
+struct GraphSnapshotData {
+    std::vector<std::string> names;
+    std::vector<double> x, y, z;
+    std::vector<int32_t> weight, profit;
+    std::vector<int64_t> offsets;
+    std::vector<int32_t> targets;
+    std::vector<double> distances;
+    std::vector<int32_t> route_from, route_to;
+    std::vector<double> route_distance;
+};
+
+// Define GraphSnapshot struct: read-only view of a memory-mapped snapshot file
+struct GraphSnapshot {
+    uint64_t star_count = 0;
+    uint64_t route_count = 0;
+    const uint64_t *name_offsets = nullptr;
+    const char *name_bytes = nullptr;
+    const double *x = nullptr, *y = nullptr, *z = nullptr;
+    const int32_t *weight = nullptr, *profit = nullptr;
+    const int64_t *offsets = nullptr;
+    const int32_t *targets = nullptr;
+    const double *distances = nullptr;
+    const int32_t *route_from = nullptr, *route_to = nullptr;
+    const double *route_distance = nullptr;
+    void *mapping = nullptr;
+    size_t mapping_size = 0;
+    std::vector<char> buffer; // used instead of a mapping where mmap is not available
+};
+
+// Function to round a byte count up to the next multiple of 8
+size_t snapshot_align(size_t bytes) {
+    return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+// Function to return the name of star i of an open snapshot
+std::string snapshot_star_name(const GraphSnapshot &snapshot, uint64_t i) {
+    return std::string(snapshot.name_bytes + snapshot.name_offsets[i], snapshot.name_bytes + snapshot.name_offsets[i + 1]);
+}
+
+// Function to parse the text dataset into snapshot arrays
+// Stars are indexed in file order; a route naming an unknown star is skipped
+bool build_snapshot_from_text(const std::string &filename, GraphSnapshotData &data) {
+    std::ifstream infile(filename);
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+
+    StarIdTable index;
+    std::string line, name, from, to;
+    while (std::getline(infile, line)) {
+        double x, y, z, distance;
+        int weight, profit;
+        if (parse_star_line(line, name, x, y, z, weight, profit)) {
+            if (index.find(name) >= 0) {
+                continue;
+            }
+            index.intern(name);
+            data.names.push_back(name);
+            data.x.push_back(x);
+            data.y.push_back(y);
+            data.z.push_back(z);
+            data.weight.push_back(weight);
+            data.profit.push_back(profit);
+        } else if (parse_route_line(line, from, to, distance)) {
+            if (index.find(from) < 0 || index.find(to) < 0) {
+                continue;
+            }
+            data.route_from.push_back(index.find(from));
+            data.route_to.push_back(index.find(to));
+            data.route_distance.push_back(distance);
+        }
+    }
+    infile.close();
+
+    // Counting sort of both route directions into CSR order
+    size_t n = data.names.size();
+    data.offsets.assign(n + 1, 0);
+    for (size_t r = 0; r < data.route_from.size(); ++r) {
+        ++data.offsets[data.route_from[r] + 1];
+        ++data.offsets[data.route_to[r] + 1];
+    }
+    for (size_t i = 0; i < n; ++i) {
+        data.offsets[i + 1] += data.offsets[i];
+    }
+    std::vector<int64_t> cursor(data.offsets.begin(), data.offsets.end() - 1);
+    data.targets.resize(data.offsets[n]);
+    data.distances.resize(data.offsets[n]);
+    for (size_t r = 0; r < data.route_from.size(); ++r) {
+        int32_t a = data.route_from[r], b = data.route_to[r];
+        data.targets[cursor[a]] = b;
+        data.distances[cursor[a]++] = data.route_distance[r];
+        data.targets[cursor[b]] = a;
+        data.distances[cursor[b]++] = data.route_distance[r];
+    }
+
+    return true;
+}
+
+// Function to write one array and pad it to 8 bytes
+template <typename T>
+void snapshot_write_array(std::ofstream &outfile, const std::vector<T> &values) {
+    static const char padding[8] = {0};
+    size_t bytes = sizeof(T) * values.size();
+    outfile.write(reinterpret_cast<const char *>(values.data()), bytes);
+    outfile.write(padding, snapshot_align(bytes) - bytes);
+}
+
+// Function to write snapshot arrays to a file
+bool save_graph_snapshot(const GraphSnapshotData &data, const std::string &filename) {
+    std::ofstream outfile(filename, std::ios::binary);
+    if (!outfile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+
+    GraphSnapshotHeader header = {GRAPH_SNAPSHOT_MAGIC, GRAPH_SNAPSHOT_VERSION, data.names.size(), data.route_from.size()};
+    outfile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    std::vector<uint64_t> name_offsets(1, 0);
+    std::vector<char> name_bytes;
+    for (const auto &name : data.names) {
+        name_bytes.insert(name_bytes.end(), name.begin(), name.end());
+        name_offsets.push_back(name_bytes.size());
+    }
+    snapshot_write_array(outfile, name_offsets);
+    snapshot_write_array(outfile, name_bytes);
+    snapshot_write_array(outfile, data.x);
+    snapshot_write_array(outfile, data.y);
+    snapshot_write_array(outfile, data.z);
+    snapshot_write_array(outfile, data.weight);
+    snapshot_write_array(outfile, data.profit);
+    snapshot_write_array(outfile, data.offsets);
+    snapshot_write_array(outfile, data.targets);
+    snapshot_write_array(outfile, data.distances);
+    snapshot_write_array(outfile, data.route_from);
+    snapshot_write_array(outfile, data.route_to);
+    snapshot_write_array(outfile, data.route_distance);
+
+    outfile.close();
+    return static_cast<bool>(outfile);
+}
+
+// Function to release a snapshot opened with open_graph_snapshot
+void close_graph_snapshot(GraphSnapshot &snapshot) {
+#ifndef _WIN32
+    if (snapshot.mapping != nullptr) {
+        munmap(snapshot.mapping, snapshot.mapping_size);
+    }
+#endif
+    snapshot = GraphSnapshot();
+}
+
+// Function to check the index arrays of a snapshot whose sections fit in the file, O(n + routes)
+// Name and CSR offsets must start at 0 and never decrease, the CSR must hold both directions of every route,
+// and every star id must be below n, so consumers can index with them directly
+bool snapshot_indices_valid(const GraphSnapshot &snapshot, uint64_t n, uint64_t routes) {
+    if (snapshot.name_offsets[0] != 0 || snapshot.offsets[0] != 0 || static_cast<uint64_t>(snapshot.offsets[n]) != 2 * routes) {
+        return false;
+    }
+    for (uint64_t i = 0; i < n; ++i) {
+        if (snapshot.name_offsets[i] > snapshot.name_offsets[i + 1] || snapshot.offsets[i] > snapshot.offsets[i + 1]) {
+            return false;
+        }
+    }
+    auto is_star = [n](int32_t id) { return id >= 0 && static_cast<uint64_t>(id) < n; };
+    for (uint64_t e = 0; e < 2 * routes; ++e) {
+        if (!is_star(snapshot.targets[e])) {
+            return false;
+        }
+    }
+    for (uint64_t r = 0; r < routes; ++r) {
+        if (!is_star(snapshot.route_from[r]) || !is_star(snapshot.route_to[r])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Function to open a snapshot file; arrays point straight into the mapped file, nothing is parsed
+// The offsets and star ids are validated once here, so a corrupt file is rejected instead of read out of bounds
+// Falls back to reading the whole file where mmap is not available
+bool open_graph_snapshot(const std::string &filename, GraphSnapshot &snapshot) {
+    const char *bytes = nullptr;
+    size_t size = 0;
+
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    struct stat info;
+    fstat(fd, &info);
+    size = static_cast<size_t>(info.st_size);
+    void *mapping = size >= sizeof(GraphSnapshotHeader) ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "Error mapping file: " << filename << std::endl;
+        return false;
+    }
+    snapshot.mapping = mapping;
+    snapshot.mapping_size = size;
+    bytes = static_cast<const char *>(mapping);
+#else
+    std::ifstream infile(filename, std::ios::binary);
+    if (!infile.is_open()) {
+        std::cerr << "Error opening file: " << filename << std::endl;
+        return false;
+    }
+    snapshot.buffer.assign(std::istreambuf_iterator<char>(infile), std::istreambuf_iterator<char>());
+    size = snapshot.buffer.size();
+    bytes = snapshot.buffer.data();
+#endif
+
+    GraphSnapshotHeader header;
+    if (size < sizeof(header)) {
+        std::cerr << "Not a graph snapshot: " << filename << std::endl;
+        close_graph_snapshot(snapshot);
+        return false;
+    }
+    std::memcpy(&header, bytes, sizeof(header));
+    uint64_t n = header.star_count, routes = header.route_count;
+
+    // Walk the sections in file order, checking that each fits
+    // Every star and route takes at least 8 bytes of the file, which bounds both counts before any section
+    // size is computed, so none of the sizes below can overflow
+    size_t position = sizeof(header);
+    bool fits = header.magic == GRAPH_SNAPSHOT_MAGIC && header.version == GRAPH_SNAPSHOT_VERSION
+                && n <= std::min<uint64_t>(size / 8, INT32_MAX) && routes <= size / 8;
+    auto section = [&](size_t bytes_needed) -> const char * {
+        const char *start = bytes + position;
+        position += snapshot_align(bytes_needed);
+        fits = fits && position <= size;
+        return start;
+    };
+    snapshot.name_offsets = reinterpret_cast<const uint64_t *>(section(sizeof(uint64_t) * (n + 1)));
+    fits = fits && snapshot.name_offsets[n] <= size;
+    snapshot.name_bytes = section(fits ? snapshot.name_offsets[n] : 0);
+    snapshot.x = reinterpret_cast<const double *>(section(sizeof(double) * n));
+    snapshot.y = reinterpret_cast<const double *>(section(sizeof(double) * n));
+    snapshot.z = reinterpret_cast<const double *>(section(sizeof(double) * n));
+    snapshot.weight = reinterpret_cast<const int32_t *>(section(sizeof(int32_t) * n));
+    snapshot.profit = reinterpret_cast<const int32_t *>(section(sizeof(int32_t) * n));
+    snapshot.offsets = reinterpret_cast<const int64_t *>(section(sizeof(int64_t) * (n + 1)));
+    snapshot.targets = reinterpret_cast<const int32_t *>(section(sizeof(int32_t) * 2 * routes));
+    snapshot.distances = reinterpret_cast<const double *>(section(sizeof(double) * 2 * routes));
+    snapshot.route_from = reinterpret_cast<const int32_t *>(section(sizeof(int32_t) * routes));
+    snapshot.route_to = reinterpret_cast<const int32_t *>(section(sizeof(int32_t) * routes));
+    snapshot.route_distance = reinterpret_cast<const double *>(section(sizeof(double) * routes));
+
+    if (!fits || !snapshot_indices_valid(snapshot, n, routes)) {
+        std::cerr << "Not a graph snapshot: " << filename << std::endl;
+        close_graph_snapshot(snapshot);
+        return false;
+    }
+    snapshot.star_count = n;
+    snapshot.route_count = routes;
+    return true;
+}
+
+// Function to tell whether a file name refers to a snapshot rather than the text dataset
+bool is_snapshot_file(const std::string &filename) {
+    return filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".snap") == 0;
+}
+
+#endif // GRAPH_SNAPSHOT_H
@@ -0,0 +1,69 @@
+#ifndef STAR_IDS_H
+#define STAR_IDS_H
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <unordered_map>
+
+// Star names are any run of non-space characters without '-' (which separates the two ends of a route)
+// Every loader numbers stars 0, 1, 2, ... in the order they are first declared, and the algorithms work on those ids
+
+// Define StarIdTable struct: dense 32-bit star ids and the name <-> id mapping
+struct StarIdTable {
+    std::vector<std::string> names;                // id -> name
+    std::unordered_map<std::string, int32_t> ids;  // name -> id
+
+    // Function to return the id of a star, numbering it if it is new
+    int32_t intern(const std::string &name) {
+        auto it = ids.find(name);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        int32_t id = static_cast<int32_t>(names.size());
+        ids.emplace(name, id);
+        names.push_back(name);
+        return id;
+    }
+
+    // Function to look up the id of a star, -1 if it has not been declared
+    int32_t find(const std::string &name) const {
+        auto it = ids.find(name);
+        return it == ids.end() ? -1 : it->second;
+    }
+
+    int32_t size() const { return static_cast<int32_t>(names.size()); }
+};
+
+// Function to name the star with the given index as the dataset generators do: A..Z, then AA..ZZ, then AAA.., like spreadsheet columns
+std::string generated_star_name(int index) {
+    std::string name;
+    for (++index; index > 0; index = (index - 1) / 26) {
+        name.insert(name.begin(), static_cast<char>('A' + (index - 1) % 26));
+    }
+    return name;
+}
+
+// Function to parse a "Star <name> <x> <y> <z> <weight> <profit>" line
+bool parse_star_line(const std::string &line, std::string &name, double &x, double &y, double &z, int &weight, int &profit) {
+    char buffer[256];
+    if (std::sscanf(line.c_str(), "Star %255s %lf %lf %lf %d %d", buffer, &x, &y, &z, &weight, &profit) != 6) {
+        return false;
+    }
+    name = buffer;
+    return true;
+}
+
+// Function to parse a "Route <from>-<to> Distance: <d>" line; "<from> - <to>" is accepted too
+bool parse_route_line(const std::string &line, std::string &from, std::string &to, double &distance) {
+    char from_buffer[256], to_buffer[256];
+    if (std::sscanf(line.c_str(), "Route %255[^- ] - %255s Distance: %lf", from_buffer, to_buffer, &distance) != 3) {
+        return false;
+    }
+    from = from_buffer;
+    to = to_buffer;
+    return true;
+}
+
+#endif // STAR_IDS_H
@@ -0,0 +1,102 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+
+// Define ThreadPool class: persistent workers that all run the same task and then wait for the next one
+// The calling thread takes part as thread 0, so a pool of size 1 runs everything inline
+class ThreadPool {
+public:
+    explicit ThreadPool(int thread_count) : thread_count_(std::max(1, thread_count)) {
+        for (int t = 1; t < thread_count_; ++t) {
+            workers_.emplace_back([this, t]() { worker_loop(t); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            ++generation_;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    int size() const { return thread_count_; }
+
+    // Function to run task(thread_index) on every thread and return once all of them finish
+    void run(const std::function<void(int)> &task) {
+        if (thread_count_ == 1) {
+            task(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            pending_ = thread_count_ - 1;
+            ++generation_;
+        }
+        wake_.notify_all();
+        task(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this]() { return pending_ == 0; });
+        task_ = nullptr;
+    }
+
+    // Function to split [0, count) into contiguous chunks, one per thread, and run body(begin, end, thread_index)
+    void parallel_for(int count, const std::function<void(int, int, int)> &body) {
+        run([&](int t) {
+            long long begin = static_cast<long long>(count) * t / thread_count_;
+            long long end = static_cast<long long>(count) * (t + 1) / thread_count_;
+            if (begin < end) {
+                body(static_cast<int>(begin), static_cast<int>(end), t);
+            }
+        });
+    }
+
+private:
+    void worker_loop(int index) {
+        unsigned long long seen = 0;
+        while (true) {
+            const std::function<void(int)> *task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this, seen]() { return generation_ != seen; });
+                seen = generation_;
+                if (stopping_) {
+                    return;
+                }
+                task = task_;
+            }
+            (*task)(index);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --pending_;
+            }
+            done_.notify_one();
+        }
+    }
+
+    int thread_count_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_, done_;
+    const std::function<void(int)> *task_ = nullptr;
+    unsigned long long generation_ = 0;
+    int pending_ = 0;
+    bool stopping_ = false;
+};
+
+#endif // THREAD_POOL_H